@@ -1,3 +1,6 @@
+// Scales the Output, Lets Otherwise Identical Pipelines be Specialized Apart
+[[vk::constant_id(0)]] const float COLOR_SCALE = 1.0;
+
 struct PixelInputType
 {
     float4 position : SV_Position;
@@ -12,7 +15,7 @@ struct PixelOutput
 PixelOutput main(PixelInputType input)
 {
     PixelOutput output;
-    output.color = float4(input.color, 1.0);
+    output.color = float4(input.color * COLOR_SCALE, 1.0);
     
     return output;
 }
@@ -0,0 +1,52 @@
+#include "AllocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    // Thread Local so Pipeline Rebuilds and Driver Threads do not Count Against the Frame
+    thread_local bool     isCounting      = false;
+    thread_local uint64_t allocationCount = 0;
+
+    void* allocate(std::size_t size, std::size_t alignment)
+    {
+        if (isCounting)
+            allocationCount++;
+
+        if (size == 0)
+            size = 1;
+
+        void *pointer = nullptr;
+        if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            pointer = std::malloc(size);
+        else
+            pointer = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+
+        if (!pointer)
+            throw std::bad_alloc();
+
+        return pointer;
+    }
+}
+
+void beginAllocationCount()
+{
+    allocationCount = 0;
+    isCounting      = true;
+}
+
+uint64_t endAllocationCount()
+{
+    isCounting = false;
+    return allocationCount;
+}
+
+// Array and Non-Throwing Forms Forward to these by Default
+void* operator new(std::size_t size)                             { return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocate(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void *pointer) noexcept                                { std::free(pointer); }
+void operator delete(void *pointer, std::size_t) noexcept                   { std::free(pointer); }
+void operator delete(void *pointer, std::align_val_t) noexcept              { std::free(pointer); }
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
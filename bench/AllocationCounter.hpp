@@ -0,0 +1,8 @@
+#pragma once
+
+#include <cstdint>
+
+// Counts Global operator new Calls Made by the Calling Thread Between Begin and End
+// The Bench Replaces the Global Allocation Functions, the Engine Library is Unaffected
+void beginAllocationCount();
+uint64_t endAllocationCount();
@@ -0,0 +1,386 @@
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <memory>
+
+#include "Settings.hpp"
+
+#include "AllocationCounter.hpp"
+
+#include "Scene/Scene.hpp"
+#include "Scene/Mesh.hpp"
+
+#include "Vulkan/Renderer/Renderer.hpp"
+#include "Vulkan/Core/Context.hpp"
+#include "Vulkan/Core/PhysicalDevice.hpp"
+#include "Vulkan/Swapchain/Swapchain.hpp"
+#include "Vulkan/Pipeline/PipelineLibrary.hpp"
+#include "Vulkan/Resources/MemoryAllocator.hpp"
+#include "Vulkan/Profiling/GpuProfiler.hpp"
+#include "Vulkan/Resources/FrameReadback.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedMilliseconds(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+static BenchmarkTimings summarize(std::vector<double> samples)
+{
+    BenchmarkTimings timings{};
+    if (samples.empty())
+        return timings;
+
+    std::sort(samples.begin(), samples.end());
+
+    double total = 0.0;
+    for (double sample : samples)
+        total += sample;
+
+    auto percentile = [&samples](double p) {
+        size_t index = static_cast<size_t>(std::ceil(p * static_cast<double>(samples.size()))) - 1;
+        return samples[std::min(index, samples.size() - 1)];
+    };
+
+    timings.mean   = total / static_cast<double>(samples.size());
+    timings.median = percentile(0.50);
+    timings.p95    = percentile(0.95);
+    timings.max    = samples.back();
+
+    return timings;
+}
+
+static const char* getDeviceTypeName(VkPhysicalDeviceType type)
+{
+    switch (type)
+    {
+        case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU: return "integrated";
+        case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:   return "discrete";
+        case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:    return "virtual";
+        case VK_PHYSICAL_DEVICE_TYPE_CPU:            return "cpu";
+        default:                                     return "other";
+    }
+}
+
+// Quad in a Square Grid Filling the Camera's View, Tinted by its Index
+static void buildQuad(
+    uint32_t index,
+    uint32_t count,
+    std::vector<Vertex>   &vertices,
+    std::vector<uint32_t> &indices
+) {
+    uint32_t gridSize = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+    float    cellSize = 2.0f / static_cast<float>(gridSize);
+
+    float x = -1.0f + cellSize * static_cast<float>(index % gridSize);
+    float y = -1.0f + cellSize * static_cast<float>(index / gridSize);
+    float z = -0.001f * static_cast<float>(index % 64);
+
+    // Never Black, so Read Back Pixels Tell Quads Apart from the Clear
+    float     size  = cellSize * 0.9f;
+    glm::vec3 color = glm::vec3(
+        static_cast<float>(index % 7 + 1) / 7.0f,
+        static_cast<float>(index % 5 + 1) / 5.0f,
+        static_cast<float>(index % 3 + 1) / 3.0f
+    );
+
+    vertices = {
+        Vertex(glm::vec3(x,        y,        z), color),
+        Vertex(glm::vec3(x + size, y,        z), color),
+        Vertex(glm::vec3(x + size, y + size, z), color),
+        Vertex(glm::vec3(x,        y + size, z), color)
+    };
+    indices = { 0, 1, 2, 2, 3, 0 };
+}
+
+// Texels whose Color Differs from the Black Clear, Alpha is Ignored
+static uint64_t countDrawnPixels(const VulkanReadbackFrame &frame)
+{
+    switch (frame.format)
+    {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+            break;
+
+        default:
+            throw std::runtime_error("Read Back Frame has a Format the Benchmark cannot Check.");
+    }
+
+    uint64_t drawn = 0;
+    for (uint32_t y = 0; y < frame.extent.height; ++y)
+    {
+        const uint8_t *row = frame.data + static_cast<size_t>(y) * frame.rowPitch;
+        for (uint32_t x = 0; x < frame.extent.width; ++x)
+        {
+            const uint8_t *texel = row + static_cast<size_t>(x) * 4;
+            if (texel[0] != 0 || texel[1] != 0 || texel[2] != 0)
+                drawn++;
+        }
+    }
+
+    return drawn;
+}
+
+BenchmarkResult runBenchmark(const BenchmarkConfig &config)
+{
+    BenchmarkResult result{};
+    result.config = config;
+
+    // Headless, Picks Software Rasterizers such as Lavapipe when there is No GPU
+    auto renderer = VulkanRenderer::Create(nullptr);
+    renderer->SetPipelineStatisticsEnabled(config.pipelineStatistics);
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(renderer->GetContext().GetPhysicalDevice().GetHandle(), &properties);
+
+    result.deviceName = properties.deviceName;
+    result.deviceType = getDeviceTypeName(properties.deviceType);
+
+    std::shared_ptr<VulkanScene> scene = VulkanScene::Create(
+        renderer->GetContext().GetPhysicalDevice(),
+        renderer->GetContext().GetDevice(),
+        renderer->GetDescriptorPool(),
+        renderer->GetAllocator(),
+        FRAMES_IN_FLIGHT
+    );
+    renderer->SetScene(scene);
+
+    // Meshes
+    std::vector<VulkanMesh*> meshes;
+    std::vector<Vertex>      vertices;
+    std::vector<uint32_t>    indices;
+
+    for (uint32_t i = 0; i < config.meshCount; ++i)
+    {
+        buildQuad(i, config.meshCount, vertices, indices);
+
+        auto mesh = VulkanMesh::Create(
+            renderer->GetContext().GetPhysicalDevice(),
+            renderer->GetContext().GetDevice(),
+            renderer->GetAllocator(),
+            vertices.size() * sizeof(Vertex),
+            indices.size()  * sizeof(uint32_t),
+            FRAMES_IN_FLIGHT
+        );
+
+        for (uint32_t currentFrame = 0; currentFrame < FRAMES_IN_FLIGHT; ++currentFrame)
+            mesh->UpdateBuffers(renderer->GetTransferCommandPool(), renderer->GetSync(), vertices, indices, currentFrame);
+
+        mesh->SetInstanceCount(config.instanceCount);
+
+        meshes.push_back(mesh.get());
+        scene->AddMesh(std::move(mesh));
+    }
+
+    // Unique Pipelines, Specialized Apart so None are Deduplicated
+    VulkanPipelineLibrary &pipelineLibrary = renderer->GetPipelineLibrary();
+    VulkanPipelineDesc     baseDesc        = pipelineLibrary.GetDesc(renderer->GetPipelineHandle());
+
+    Clock::time_point buildStart = Clock::now();
+    for (uint32_t i = 1; i < config.pipelineCount; ++i)
+    {
+        VulkanPipelineDesc desc = baseDesc;
+        desc.SetSpecializationConstant(VK_SHADER_STAGE_FRAGMENT_BIT, 0, 1.0f - 1.0e-4f * static_cast<float>(i));
+
+        pipelineLibrary.Add(desc);
+    }
+    pipelineLibrary.Trim();
+    result.pipelineBuildTime = elapsedMilliseconds(buildStart, Clock::now());
+
+    // Frames
+    std::vector<double> frameTimes, waitTimes, recordTimes, submitTimes, uploadTimes;
+
+    uint32_t uploadCursor = 0;
+    uint32_t totalFrames  = config.warmupFrames + config.frameCount;
+    for (uint32_t frame = 0; frame < totalFrames; ++frame)
+    {
+        bool isMeasured = frame >= config.warmupFrames;
+
+        // Frame, Steady State Should Never Touch the Global Heap
+        Clock::time_point frameStart = Clock::now();
+        if (isMeasured)
+            beginAllocationCount();
+
+        // The Frame's Buffers are Free to Rewrite only once its Fence has Signaled
+        renderer->BeginFrame();
+
+        if (isMeasured)
+            result.heapAllocations += endAllocationCount();
+
+        // Uploads
+        Clock::time_point uploadStart = Clock::now();
+        for (uint32_t i = 0; i < config.uploadsPerFrame && !meshes.empty(); ++i)
+        {
+            uint32_t meshIndex = uploadCursor++ % static_cast<uint32_t>(meshes.size());
+
+            buildQuad(meshIndex, config.meshCount, vertices, indices);
+            meshes[meshIndex]->UpdateBuffers(
+                renderer->GetTransferCommandPool(),
+                renderer->GetSync(),
+                vertices,
+                indices,
+                renderer->GetCurrentFrame()
+            );
+        }
+        Clock::time_point uploadEnd = Clock::now();
+
+        if (isMeasured)
+            beginAllocationCount();
+
+        scene->Update(
+            nullptr,
+            renderer->GetSwapchain().GetExtent(),
+            FRAME_TIME,
+            renderer->GetCurrentFrame()
+        );
+        renderer->Draw();
+
+        Clock::time_point frameEnd = Clock::now();
+
+        if (!isMeasured)
+            continue;
+
+        result.heapAllocations += endAllocationCount();
+
+        const VulkanRendererStats &stats = renderer->GetStats();
+
+        uploadTimes.push_back(elapsedMilliseconds(uploadStart, uploadEnd));
+        frameTimes.push_back(elapsedMilliseconds(frameStart, uploadStart) + elapsedMilliseconds(uploadEnd, frameEnd));
+        waitTimes.push_back(stats.waitTime   * 1000.0);
+        recordTimes.push_back(stats.recordTime * 1000.0);
+        submitTimes.push_back(stats.submitTime * 1000.0);
+
+        result.drawCalls = stats.drawCalls;
+        result.instances = stats.instances;
+    }
+
+    // One More Frame Copied to the Host, Delivered by Finish once the Device is Idle
+    bool isReadBack = false;
+    if (config.readback)
+    {
+        renderer->RequestReadback([&result, &isReadBack](const VulkanReadbackFrame &frame) {
+            result.readbackPixels = countDrawnPixels(frame);
+            isReadBack            = true;
+        });
+        renderer->Draw();
+    }
+
+    renderer->Finish();
+
+    if (config.readback && !isReadBack)
+        throw std::runtime_error("Requested Readback was Never Delivered.");
+
+    result.frameTime  = summarize(std::move(frameTimes));
+    result.waitTime   = summarize(std::move(waitTimes));
+    result.recordTime = summarize(std::move(recordTimes));
+    result.submitTime = summarize(std::move(submitTimes));
+    result.uploadTime = summarize(std::move(uploadTimes));
+
+    // The Profiler's Rolling History Holds the Most Recent Measured Frames
+    if (const VulkanGpuProfiler *profiler = renderer->GetGpuProfiler())
+    {
+        for (const auto &scope : profiler->GetScopes())
+            result.gpuTimes.emplace_back(scope.name, summarize(scope.history));
+    }
+
+    if (const VulkanPipelineStatistics *statistics = renderer->GetPipelineStatistics())
+        result.pipelineStatistics = statistics->GetResults();
+
+    result.allocatedBytes  = renderer->GetAllocator().GetAllocatedBytes();
+    result.allocationCount = renderer->GetAllocator().GetAllocationCount();
+
+    return result;
+}
+
+static void writeTimings(std::ostream &stream, const char *name, const BenchmarkTimings &timings, bool last = false)
+{
+    stream << "        \"" << name << "\": { "
+           << "\"mean\": "   << timings.mean   << ", "
+           << "\"median\": " << timings.median << ", "
+           << "\"p95\": "    << timings.p95    << ", "
+           << "\"max\": "    << timings.max
+           << " }" << (last ? "\n" : ",\n");
+}
+
+void writeBenchmarkJson(std::ostream &stream, const std::vector<BenchmarkResult> &results)
+{
+    stream << std::fixed << std::setprecision(4);
+
+    stream << "{\n";
+    stream << "  \"unit\": \"ms\",\n";
+    stream << "  \"benchmarks\": [\n";
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchmarkResult &result = results[i];
+        const BenchmarkConfig &config = result.config;
+
+        stream << "    {\n";
+        stream << "      \"name\": \""       << config.name       << "\",\n";
+        stream << "      \"device\": \""     << result.deviceName << "\",\n";
+        stream << "      \"deviceType\": \"" << result.deviceType << "\",\n";
+
+        stream << "      \"config\": { "
+               << "\"meshes\": "          << config.meshCount       << ", "
+               << "\"instances\": "       << config.instanceCount   << ", "
+               << "\"pipelines\": "       << config.pipelineCount   << ", "
+               << "\"uploadsPerFrame\": " << config.uploadsPerFrame << ", "
+               << "\"warmupFrames\": "    << config.warmupFrames    << ", "
+               << "\"frames\": "          << config.frameCount
+               << " },\n";
+
+        stream << "      \"cpu\": {\n";
+        writeTimings(stream, "frame",  result.frameTime);
+        writeTimings(stream, "wait",   result.waitTime);
+        writeTimings(stream, "record", result.recordTime);
+        writeTimings(stream, "submit", result.submitTime);
+        writeTimings(stream, "upload", result.uploadTime, true);
+        stream << "      },\n";
+
+        stream << "      \"gpu\": {\n";
+        for (size_t j = 0; j < result.gpuTimes.size(); ++j)
+            writeTimings(stream, result.gpuTimes[j].first.c_str(), result.gpuTimes[j].second, j + 1 == result.gpuTimes.size());
+        stream << "      },\n";
+
+        stream << "      \"pipelineStatistics\": {\n";
+        for (size_t j = 0; j < result.pipelineStatistics.size(); ++j)
+        {
+            const VulkanPipelineStatisticsResult &statistics = result.pipelineStatistics[j];
+
+            stream << "        \"" << statistics.name << "\": { "
+                   << "\"iaVertices\": "          << statistics.inputAssemblyVertices     << ", "
+                   << "\"iaPrimitives\": "        << statistics.inputAssemblyPrimitives   << ", "
+                   << "\"vsInvocations\": "       << statistics.vertexShaderInvocations   << ", "
+                   << "\"clippingInvocations\": " << statistics.clippingInvocations       << ", "
+                   << "\"clippingPrimitives\": "  << statistics.clippingPrimitives        << ", "
+                   << "\"fsInvocations\": "       << statistics.fragmentShaderInvocations
+                   << " }" << (j + 1 < result.pipelineStatistics.size() ? ",\n" : "\n");
+        }
+        stream << "      },\n";
+
+        stream << "      \"pipelineBuild\": " << result.pipelineBuildTime << ",\n";
+        stream << "      \"drawCalls\": "     << result.drawCalls         << ",\n";
+        stream << "      \"instances\": "     << result.instances         << ",\n";
+
+        stream << "      \"memory\": { "
+               << "\"allocatedBytes\": " << result.allocatedBytes  << ", "
+               << "\"allocations\": "    << result.allocationCount << ", "
+               << "\"heapAllocationsPerFrame\": "
+               << static_cast<double>(result.heapAllocations) / static_cast<double>(std::max(config.frameCount, 1u))
+               << " }" << (config.readback ? ",\n" : "\n");
+
+        if (config.readback)
+            stream << "      \"readbackPixels\": " << result.readbackPixels << "\n";
+
+        stream << "    }" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+
+    stream << "  ]\n";
+    stream << "}\n";
+}
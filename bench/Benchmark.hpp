@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "Vulkan/Profiling/PipelineStatistics.hpp"
+
+// One Synthetic Scene, Rendered Headless for a Fixed Number of Frames
+struct BenchmarkConfig
+{
+    std::string name = "custom";
+
+    uint32_t meshCount       = 1;
+    uint32_t instanceCount   = 1;   // Per Mesh
+    uint32_t pipelineCount   = 1;   // Unique Pipelines Built into the Library
+    uint32_t uploadsPerFrame = 0;   // Mesh Buffer Updates Before Every Draw
+
+    uint32_t warmupFrames = 30;
+    uint32_t frameCount   = 300;
+
+    bool pipelineStatistics = false;  // Per Pass Shader Invocation Counts, Skews GPU Timings Slightly
+    bool readback           = false;  // Reads Back One Unmeasured Frame after the Others and Counts Drawn Pixels
+};
+
+// Milliseconds Across the Measured Frames
+struct BenchmarkTimings
+{
+    double mean   = 0.0;
+    double median = 0.0;
+    double p95    = 0.0;
+    double max    = 0.0;
+};
+
+struct BenchmarkResult
+{
+    BenchmarkConfig config;
+
+    std::string deviceName;
+    std::string deviceType;
+
+    BenchmarkTimings frameTime;
+    BenchmarkTimings waitTime;
+    BenchmarkTimings recordTime;
+    BenchmarkTimings submitTime;
+    BenchmarkTimings uploadTime;
+
+    // Per GPU Profiler Scope, Empty when Timestamps are Unsupported
+    std::vector<std::pair<std::string, BenchmarkTimings>> gpuTimes;
+
+    // Counters of the Last Collected Frame, Empty Unless Requested and Supported
+    std::vector<VulkanPipelineStatisticsResult> pipelineStatistics;
+
+    double pipelineBuildTime = 0.0;  // Milliseconds for Every Extra Pipeline
+
+    uint32_t drawCalls = 0;
+    uint32_t instances = 0;
+
+    VkDeviceSize allocatedBytes  = 0;
+    uint32_t     allocationCount = 0;
+
+    // Global operator new Calls During Measured Scene Updates and Draws, Uploads Excluded
+    uint64_t heapAllocations = 0;
+
+    // Pixels of the Read Back Frame Not Left at the Clear Color, Zero Means Nothing Reached the Host
+    uint64_t readbackPixels = 0;
+};
+
+BenchmarkResult runBenchmark(const BenchmarkConfig &config);
+
+void writeBenchmarkJson(std::ostream &stream, const std::vector<BenchmarkResult> &results);
@@ -0,0 +1,149 @@
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+// Usage: Vulkan-Engine-Bench [--output file.json] [--frames N] [--pipeline-stats] [--check-allocations] [--readback]
+//                            [--meshes N] [--instances N] [--pipelines N] [--uploads M]
+// Without Scene Arguments the Default Suite Runs, Results Go to a File since the Renderer Logs to stdout
+// --check-allocations Fails the Run if any Measured Frame Allocated from the Global Heap
+// --readback Fails the Run if a Frame Read Back after the Measured Ones Shows Nothing Drawn
+int main(int argc, char **argv)
+{
+    std::string outputPath = "benchmark.json";
+
+    BenchmarkConfig custom{};
+    bool            isCustom   = false;
+    uint32_t        frameCount = custom.frameCount;
+
+    bool pipelineStatistics = false;
+    bool checkAllocations   = false;
+    bool readback           = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string argument = argv[i];
+        if (argument == "--pipeline-stats")
+        {
+            pipelineStatistics = true;
+            continue;
+        }
+        if (argument == "--check-allocations")
+        {
+            checkAllocations = true;
+            continue;
+        }
+        if (argument == "--readback")
+        {
+            readback = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+        {
+            std::cerr << "[ERROR]\tMissing Value for '" << argument << "'.\n";
+            return 1;
+        }
+
+        std::string value = argv[++i];
+
+        if      (argument == "--output")    { outputPath = value; }
+        else if (argument == "--frames")    { frameCount = static_cast<uint32_t>(std::stoul(value)); }
+        else if (argument == "--meshes")    { custom.meshCount       = static_cast<uint32_t>(std::stoul(value)); isCustom = true; }
+        else if (argument == "--instances") { custom.instanceCount   = static_cast<uint32_t>(std::stoul(value)); isCustom = true; }
+        else if (argument == "--pipelines") { custom.pipelineCount   = static_cast<uint32_t>(std::stoul(value)); isCustom = true; }
+        else if (argument == "--uploads")   { custom.uploadsPerFrame = static_cast<uint32_t>(std::stoul(value)); isCustom = true; }
+        else
+        {
+            std::cerr << "[ERROR]\tUnknown Argument '" << argument << "'.\n";
+            return 1;
+        }
+    }
+
+    std::vector<BenchmarkConfig> configs;
+    if (isCustom)
+    {
+        configs.push_back(custom);
+    }
+    else
+    {
+        // Each Case Stresses One Path, Draw Recording, Instancing, Pipeline Builds or Uploads
+        configs = {
+            { "baseline",  1,    1,     1,  0  },
+            { "meshes",    1024, 1,     1,  0  },
+            { "instances", 1,    16384, 1,  0  },
+            { "pipelines", 1,    1,     64, 0  },
+            { "uploads",   64,   1,     1,  16 }
+        };
+    }
+
+    std::vector<BenchmarkResult> results;
+
+    try {
+        for (auto &config : configs)
+        {
+            config.frameCount         = frameCount;
+            config.pipelineStatistics = pipelineStatistics;
+            config.readback           = readback;
+
+            std::cerr << "[INFO]\tRunning Benchmark '" << config.name << "'.\n";
+            results.push_back(runBenchmark(config));
+        }
+    }
+    catch (const std::exception &exception)
+    {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
+
+    std::ofstream file(outputPath);
+    if (!file)
+    {
+        std::cerr << "[ERROR]\tFailed to Open '" << outputPath << "'.\n";
+        return 1;
+    }
+
+    writeBenchmarkJson(file, results);
+
+    std::cerr << "[INFO]\tBenchmark Results Written to '" << outputPath << "'.\n";
+
+    if (checkAllocations)
+    {
+        bool hasAllocations = false;
+        for (const auto &result : results)
+        {
+            if (result.heapAllocations == 0)
+                continue;
+
+            std::cerr << "[ERROR]\tBenchmark '" << result.config.name << "' Made " << result.heapAllocations
+                      << " Heap Allocations over " << result.config.frameCount << " Measured Frames.\n";
+            hasAllocations = true;
+        }
+
+        if (hasAllocations)
+            return 1;
+    }
+
+    if (readback)
+    {
+        bool isBlank = false;
+        for (const auto &result : results)
+        {
+            if (result.readbackPixels > 0)
+                continue;
+
+            std::cerr << "[ERROR]\tBenchmark '" << result.config.name << "' Read Back a Frame with Nothing Drawn.\n";
+            isBlank = true;
+        }
+
+        if (isBlank)
+            return 1;
+    }
+
+    return 0;
+}
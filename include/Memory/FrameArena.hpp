@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// Bump Allocator for Data that Lives Only Until its Frame Index Comes Around Again
+// Frees are Ignored, Reset Releases Everything at Once, Overflow Falls Back to the Global Heap
+class FrameArena : public std::pmr::memory_resource
+{
+    public:
+        ~FrameArena() override = default;
+
+        static std::unique_ptr<FrameArena> Create(size_t capacity);
+
+        // Call once Nothing Allocated Since the Last Reset is Referenced
+        void Reset();
+
+        size_t GetCapacity()      const { return m_capacity; }
+        size_t GetUsedBytes()     const { return m_offset; }
+        size_t GetPeakBytes()     const { return m_peakBytes; }
+        size_t GetOverflowBytes() const { return m_overflowBytes; }
+
+    private:
+        FrameArena(std::unique_ptr<std::byte[]> buffer, size_t capacity);
+
+        // Remove Copying Semantics
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void  do_deallocate(void *pointer, size_t bytes, size_t alignment) override;
+        bool  do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+        std::unique_ptr<std::byte[]> m_buffer;
+        size_t                       m_capacity = 0;
+        size_t                       m_offset   = 0;
+        size_t                       m_peakBytes = 0;
+
+        // Released on Reset, Only Touched when a Frame Outgrows the Buffer
+        std::pmr::monotonic_buffer_resource m_overflow;
+        size_t                              m_overflowBytes = 0;
+        bool                                m_hasWarned     = false;
+};
+
+// STL Allocator over a FrameArena, for Containers that do not Take a memory_resource
+template <typename T>
+class FrameAllocator
+{
+    public:
+        using value_type = T;
+
+        explicit FrameAllocator(FrameArena &arena) noexcept : m_arena(&arena) {}
+
+        template <typename U>
+        FrameAllocator(const FrameAllocator<U> &other) noexcept : m_arena(other.GetArena()) {}
+
+        T* allocate(size_t count)
+        {
+            return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+        }
+        void deallocate(T *pointer, size_t count) noexcept
+        {
+            m_arena->deallocate(pointer, count * sizeof(T), alignof(T));
+        }
+
+        FrameArena* GetArena() const noexcept { return m_arena; }
+
+        template <typename U>
+        bool operator==(const FrameAllocator<U> &other) const noexcept { return m_arena == other.GetArena(); }
+
+    private:
+        FrameArena *m_arena;
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "Settings.hpp"
+
+// Slot Index plus the Generation the Slot had when Handed Out, Trivially Copyable and Cheap to Pass Between Threads
+// A Handle that Outlives its Object Resolves to Null Rather than to Whatever Reused the Slot
+template <typename T>
+struct PoolHandle
+{
+    uint32_t index      = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != UINT32_MAX; }
+    explicit operator bool() const { return IsValid(); }
+
+    bool operator==(const PoolHandle&) const = default;
+};
+
+// Fixed-Size Slots in Chunks that Never Move, Freed Slots are Reused Most Recent First
+// Indices are Dense from Zero, so Side Tables Indexed by Handle Stay Small
+// Create, Destroy, Allocate and Release Lock, Get and GetHandle do Not and may Run on Any Thread
+template <typename T>
+class Pool
+{
+    public:
+        Pool() = default;
+
+        // Objects Still Live are Destroyed with the Pool
+        ~Pool();
+
+        // Remove Copying Semantics
+        Pool(const Pool&) = delete;
+        Pool& operator=(const Pool&) = delete;
+
+        template <typename... Args>
+        PoolHandle<T> Create(Args&&... args);
+        void Destroy(PoolHandle<T> handle);
+
+        // Uninitialized Storage for a Class-Level operator new, the Caller Constructs and Destroys the Object
+        void* Allocate();
+        void  Release(void *storage);
+
+        // Null once the Object has been Destroyed, even if its Slot was Reused
+        T* Get(PoolHandle<T> handle) const;
+        PoolHandle<T> GetHandle(const T *object) const;
+
+        uint32_t GetLiveCount() const { return m_liveCount.load(std::memory_order_relaxed); }
+
+        // One Past the Highest Index Handed Out, the Size a Side Table Needs
+        uint32_t GetCapacity() const { return m_slotCount.load(std::memory_order_acquire); }
+
+    private:
+        struct Slot
+        {
+            alignas(T) std::byte storage[sizeof(T)];
+
+            // Odd while Live, Bumped on Every Allocate and Release
+            std::atomic<uint32_t> generation = 0;
+
+            uint32_t index    = 0;
+            uint32_t nextFree = UINT32_MAX;
+        };
+
+        Slot* GetSlot(uint32_t index) const { return &m_chunks[index / POOL_CHUNK_SIZE][index % POOL_CHUNK_SIZE]; }
+
+        // Written once per Chunk Before m_slotCount Publishes It, Never Reallocated
+        std::array<std::unique_ptr<Slot[]>, POOL_MAX_CHUNKS> m_chunks;
+
+        std::atomic<uint32_t> m_slotCount = 0;
+        std::atomic<uint32_t> m_liveCount = 0;
+
+        std::mutex m_mutex;
+        uint32_t   m_freeHead = UINT32_MAX;
+};
+
+template <typename T>
+Pool<T>::~Pool()
+{
+    uint32_t slotCount = m_slotCount.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < slotCount; ++i)
+    {
+        Slot *slot = GetSlot(i);
+        if (slot->generation.load(std::memory_order_relaxed) & 1)
+            std::launder(reinterpret_cast<T*>(slot->storage))->~T();
+    }
+}
+
+template <typename T>
+template <typename... Args>
+PoolHandle<T> Pool<T>::Create(Args&&... args)
+{
+    void *storage = Allocate();
+
+    try
+    {
+        return GetHandle(::new (storage) T(std::forward<Args>(args)...));
+    }
+    catch (...)
+    {
+        Release(storage);
+        throw;
+    }
+}
+
+template <typename T>
+void Pool<T>::Destroy(PoolHandle<T> handle)
+{
+    T *object = Get(handle);
+    if (object == nullptr)
+        return;
+
+    object->~T();
+    Release(object);
+}
+
+template <typename T>
+void* Pool<T>::Allocate()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    uint32_t index = m_freeHead;
+    if (index != UINT32_MAX)
+    {
+        m_freeHead = GetSlot(index)->nextFree;
+    }
+    else
+    {
+        index = m_slotCount.load(std::memory_order_relaxed);
+
+        if (index % POOL_CHUNK_SIZE == 0)
+        {
+            if (index / POOL_CHUNK_SIZE >= POOL_MAX_CHUNKS)
+                throw std::runtime_error("Object Pool is Full.");
+
+            m_chunks[index / POOL_CHUNK_SIZE] = std::make_unique<Slot[]>(POOL_CHUNK_SIZE);
+        }
+
+        GetSlot(index)->index = index;
+        m_slotCount.store(index + 1, std::memory_order_release);
+    }
+
+    Slot *slot = GetSlot(index);
+    slot->generation.fetch_add(1, std::memory_order_release);
+    m_liveCount.fetch_add(1, std::memory_order_relaxed);
+
+    return slot->storage;
+}
+
+template <typename T>
+void Pool<T>::Release(void *storage)
+{
+    // Storage is the First Member, so the Slot Starts Where the Object Does
+    Slot *slot = reinterpret_cast<Slot*>(storage);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    slot->generation.fetch_add(1, std::memory_order_release);
+    slot->nextFree = m_freeHead;
+    m_freeHead     = slot->index;
+
+    m_liveCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+T* Pool<T>::Get(PoolHandle<T> handle) const
+{
+    if (!handle.IsValid() || handle.index >= m_slotCount.load(std::memory_order_acquire))
+        return nullptr;
+
+    Slot *slot = GetSlot(handle.index);
+    if (slot->generation.load(std::memory_order_acquire) != handle.generation)
+        return nullptr;
+
+    return std::launder(reinterpret_cast<T*>(slot->storage));
+}
+
+template <typename T>
+PoolHandle<T> Pool<T>::GetHandle(const T *object) const
+{
+    if (object == nullptr)
+        return {};
+
+    const Slot *slot = reinterpret_cast<const Slot*>(object);
+    return { slot->index, slot->generation.load(std::memory_order_acquire) };
+}
+
+// Routes a Class's new and delete Through its Own Pool, so std::unique_ptr<T>(new T(...)) Keeps Working
+// and Every Instance has a Handle Worker Threads can Hold without Owning It
+template <typename T>
+class Pooled
+{
+    public:
+        // Slots are Sized for T, so a Derived Class Must Not Land in Them
+        static void* operator new(size_t size)
+        {
+            if (size != sizeof(T))
+                throw std::bad_alloc();
+
+            return GetPool().Allocate();
+        }
+        static void operator delete(void *pointer)
+        {
+            GetPool().Release(pointer);
+        }
+
+        PoolHandle<T> GetPoolHandle() const { return GetPool().GetHandle(static_cast<const T*>(this)); }
+
+        // Null once the Object has been Deleted
+        static T* Resolve(PoolHandle<T> handle) { return GetPool().Get(handle); }
+
+        static Pool<T>& GetPool()
+        {
+            // Never Destroyed, Objects Owned by Statics may be Deleted after it Would Have Been
+            static Pool<T> *pool = new Pool<T>();
+            return *pool;
+        }
+};
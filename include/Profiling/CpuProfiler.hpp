@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Track IDs Above the Thread Range, Drawn as their Own Rows in the Trace
+constexpr uint32_t PROFILE_TRACK_GPU = 0xFFFF0000;
+
+// One Closed Zone, Timestamps in Nanoseconds Since the Profiler's Epoch
+struct CpuProfileEvent
+{
+    const char *name  = nullptr;  // Literal or Interned, Never Freed
+    uint64_t    start = 0;
+    uint64_t    end   = 0;
+    uint32_t    track = 0;        // Recording Thread, or a PROFILE_TRACK_*
+};
+
+// Scoped Zones Written to Per-Thread Lock-Free Rings, Drained into a Capture by One Consumer
+class CpuProfiler
+{
+    public:
+        static uint64_t Now();
+
+        // Only Zones Closed While Capturing are Recorded
+        static void BeginCapture();
+        static std::vector<CpuProfileEvent> EndCapture();
+        static bool IsCapturing();
+
+        // Moves Every Thread's Ring into the Capture, Call Often Enough that Rings do not Fill
+        static void Flush();
+
+        // Records a Zone Measured Elsewhere, such as a GPU Timestamp Placed on the CPU Timeline
+        static void Record(const char *name, uint64_t start, uint64_t end, uint32_t track);
+
+        // Stable Copy of a Runtime Name, Reused for Equal Strings
+        static const char* Intern(const std::string &name);
+
+        // Chrome Trace Event JSON, Loads in chrome://tracing and Perfetto
+        static void WriteChromeTrace(std::ostream &stream, const std::vector<CpuProfileEvent> &events);
+};
+
+// Records its Lifetime as a Zone when Capturing
+class CpuProfileZone
+{
+    public:
+        explicit CpuProfileZone(const char *name) : m_name(name), m_start(CpuProfiler::Now()) {}
+        ~CpuProfileZone();
+
+        CpuProfileZone(const CpuProfileZone&) = delete;
+        CpuProfileZone& operator=(const CpuProfileZone&) = delete;
+
+    private:
+        const char *m_name;
+        uint64_t    m_start;
+};
+
+// Zones Compile Out Unless ENGINE_PROFILING is Defined
+#ifdef ENGINE_PROFILING
+    #define PROFILE_CONCAT_INNER(a, b) a##b
+    #define PROFILE_CONCAT(a, b)       PROFILE_CONCAT_INNER(a, b)
+
+    #define PROFILE_ZONE(name) CpuProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#else
+    #define PROFILE_ZONE(name)
+#endif
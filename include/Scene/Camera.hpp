@@ -47,7 +47,7 @@ class Camera
         );
 
         void UpdateBuffer(
-            const Window &window,
+            float    aspectRatio,
             uint32_t currentFrame
         );
         void BindBuffer(
@@ -56,9 +56,12 @@ class Camera
             uint32_t        currentFrame
         );
 
-        glm::mat4x4 GetProjMatrix(const Window &window);
+        glm::mat4x4 GetProjMatrix(float aspectRatio);
         glm::mat4x4 GetViewMatrix();
 
+        const glm::vec3& GetPosition() const { return m_position; }
+        const glm::vec3& GetFront()    const { return m_front; }
+
         const std::unique_ptr<VulkanUniformBuffer>& GetBuffer() const { return m_buffer; }
 
         VkDescriptorSet       GetDescriptorSet(uint32_t currentFrame) const { return m_buffer->GetDescriptorSets(currentFrame); }
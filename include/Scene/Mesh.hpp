@@ -15,6 +15,7 @@ struct Vertex {
 class VulkanPhysicalDevice;
 class VulkanDevice;
 class VulkanCommandPool;
+class VulkanSync;
 class VulkanMemoryAllocator;
 
 class VulkanVertexBuffer;
@@ -38,8 +39,10 @@ class VulkanMesh
             uint32_t        currentFrame
         );
 
+        // Call Between VulkanRenderer::BeginFrame and Draw, or Before the First Frame
         void UpdateBuffers(
             const VulkanCommandPool &commandPool,
+            VulkanSync              &sync,
             const std::vector<Vertex>   &vertices,
             const std::vector<uint32_t> &indices,
             uint32_t currentFrame
@@ -47,6 +50,13 @@ class VulkanMesh
 
         void Draw(VkCommandBuffer vkCommandBuffer);
 
+        // Copies Drawn with One Call, Every Instance Shares the Mesh's Vertices
+        void SetInstanceCount(uint32_t instanceCount) { m_instanceCount = instanceCount; }
+        uint32_t GetInstanceCount() const { return m_instanceCount; }
+
+        // Bounding Box Center, Updated with the Vertices
+        const glm::vec3& GetCenter() const { return m_center; }
+
     private:
         VulkanMesh() = default;
         VulkanMesh(
@@ -67,4 +77,8 @@ class VulkanMesh
 
         uint32_t m_vertexCount = 0;
         uint32_t m_indexCount  = 0;
+
+        uint32_t m_instanceCount = 1;
+
+        glm::vec3 m_center = glm::vec3(0.0f);
 };
@@ -29,8 +29,10 @@ class VulkanScene
             uint32_t frameCount
         );
         
+        // Input is Only Read when there is a Window, Headless Cameras Stay Put
         void Update(
-            const Window &window,
+            const Window *window,
+            VkExtent2D   extent,
             double   deltaTime,
             uint32_t currentFrame
         );
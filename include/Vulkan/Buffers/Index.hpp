@@ -8,6 +8,7 @@
 class VulkanPhysicalDevice;
 class VulkanDevice;
 class VulkanCommandPool;
+class VulkanSync;
 class VulkanMemoryAllocator;
 
 class VulkanBuffer;
@@ -31,8 +32,10 @@ class VulkanIndexBuffer
             uint32_t        currentFrame
         );
         
+        // Only while the Frame is Idle, the Frame's Buffer is Rewritten without Waiting on the GPU
         void Update(
             const VulkanCommandPool &commandPool,
+            VulkanSync              &sync,
             void     *data,
             uint32_t currentFrame
         );
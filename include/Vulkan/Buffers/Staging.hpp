@@ -9,6 +9,7 @@ class VulkanPhysicalDevice;
 class VulkanDevice;
 class VulkanMemoryAllocator;
 class VulkanCommandPool;
+class VulkanSync;
 
 class VulkanBuffer;
 
@@ -24,11 +25,14 @@ class VulkanStagingBuffer
             VkDeviceSize size
         );
 
-        void Update(void *data);
+        // Waits for the Last Copy Out of the Buffer, if it is Somehow Still Running
+        void Update(VulkanSync &sync, void *data);
 
         void CopyTo(
             const VulkanCommandPool &commandPool,
-            const VulkanBuffer      &dst
+            VulkanSync              &sync,
+            const VulkanBuffer      &dst,
+            uint32_t                currentFrame
         );
 
         // Getters
@@ -52,4 +56,7 @@ class VulkanStagingBuffer
         std::unique_ptr<VulkanBuffer> m_buffer;
 
         VkDeviceSize m_size = 0;
+
+        // Ticket of the Last Copy Reading the Buffer
+        uint64_t m_upload = 0;
 };
@@ -9,6 +9,7 @@ class VulkanPhysicalDevice;
 class VulkanDevice;
 class VulkanMemoryAllocator;
 class VulkanCommandPool;
+class VulkanSync;
 
 class VulkanBuffer;
 class VulkanStagingBuffer;
@@ -30,8 +31,10 @@ class VulkanVertexBuffer
             VkCommandBuffer vkCommandBuffer,
             uint32_t        currentFrame
         );
+        // Only while the Frame is Idle, the Frame's Buffer is Rewritten without Waiting on the GPU
         void Update(
             const VulkanCommandPool &commandPool,
+            VulkanSync              &sync,
             void     *data,
             uint32_t currentFrame
         );
@@ -15,20 +15,23 @@ class VulkanCommandPool
         ~VulkanCommandPool();
 
         static std::unique_ptr<VulkanCommandPool> Create(
-            const VulkanDevice &device
+            const VulkanDevice &device,
+            uint32_t queueFamily
         );
 
         void CreateCommandBuffers(uint32_t frameCount);
         VkCommandBuffer BeginFrame(uint32_t currentFrame);
 
-        VkCommandPool GetHandle() const { return m_handle; }
+        VkCommandPool GetHandle()      const { return m_handle; }
+        uint32_t      GetQueueFamily() const { return m_queueFamily; }
 
         const std::vector<VkCommandBuffer>& GetCommandBuffers() const { return m_commandBuffers; }
 
     private:
         VulkanCommandPool(
             const VulkanDevice &device,
-            VkCommandPool handle
+            VkCommandPool handle,
+            uint32_t      queueFamily
         );
 
         void Cleanup();
@@ -45,5 +48,8 @@ class VulkanCommandPool
 
         VkCommandPool m_handle = VK_NULL_HANDLE;
 
+        // Command Buffers from this Pool may Only be Submitted to Queues of this Family
+        uint32_t m_queueFamily = 0;
+
         std::vector<VkCommandBuffer> m_commandBuffers;
 };
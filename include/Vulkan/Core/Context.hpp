@@ -20,18 +20,21 @@ class VulkanContext
     public:
         ~VulkanContext();
 
+        // A Null Window Creates a Headless Context without a Surface
         static std::unique_ptr<VulkanContext> Create(
-            const Window &window,
+            const Window *window,
             uint32_t frameCount
         );
 
         // Getters
         const VulkanInstance&       GetInstance()       const { return *m_instance;       }
-        const VulkanDebug&          GetDebug()          const { return *m_debug;          }
-        const VulkanSurface&        GetSurface()        const { return *m_surface;        }
+        const VulkanDebug*          GetDebug()          const { return m_debug.get();     }
+        const VulkanSurface*        GetSurface()        const { return m_surface.get();   }
         const VulkanPhysicalDevice& GetPhysicalDevice() const { return *m_physicalDevice; }
         const VulkanDevice&         GetDevice()         const { return *m_device;         }
 
+        bool IsHeadless() const { return m_surface == nullptr; }
+
     private:
         VulkanContext(
             std::unique_ptr<VulkanInstance>       instance,
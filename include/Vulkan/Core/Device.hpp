@@ -6,12 +6,15 @@
 #include <vulkan/vulkan.h>
 
 class VulkanPhysicalDevice;
+class VulkanLayoutCache;
+class VulkanShaderModuleCache;
 
 class VulkanDevice
 {
     public:
         static std::unique_ptr<VulkanDevice> Create(
-            const VulkanPhysicalDevice &physicalDevice
+            const VulkanPhysicalDevice &physicalDevice,
+            bool enableSwapchain = true
         );
 
         ~VulkanDevice();
@@ -23,14 +26,31 @@ class VulkanDevice
         const uint32_t GetGraphicsQueueFamily() const { return m_graphicsQueueFamily; }
         const uint32_t GetPresentQueueFamily()  const { return m_presentQueueFamily; }
 
+        // The Graphics Queue Stands In when the Device has No Transfer-Only Family
+        const VkQueue  GetTransferQueue()       const { return m_transferQueue; }
+        const uint32_t GetTransferQueueFamily() const { return m_transferQueueFamily; }
+        bool HasDedicatedTransferQueue()        const { return m_transferQueueFamily != m_graphicsQueueFamily; }
+
+        VulkanLayoutCache&       GetLayoutCache()       const { return *m_layoutCache; }
+        VulkanShaderModuleCache& GetShaderModuleCache() const { return *m_shaderModuleCache; }
+
+        // Optional Features
+        bool IsMaintenance5Enabled()       const { return m_maintenance5Enabled; }
+        bool IsDynamicRenderingEnabled()   const { return m_dynamicRenderingEnabled; }
+        bool IsSynchronization2Enabled()   const { return m_synchronization2Enabled; }
+        bool IsPipelineStatisticsEnabled() const { return m_pipelineStatisticsEnabled; }
+        bool IsMemoryBudgetEnabled()       const { return m_memoryBudgetEnabled; }
+
     private:
         VulkanDevice() = default;
         VulkanDevice(
             VkDevice handle,
             VkQueue  graphicsQueue,
             VkQueue  presentQueue,
+            VkQueue  transferQueue,
             uint32_t graphicsQueueFamily,
-            uint32_t presentQueueFamily
+            uint32_t presentQueueFamily,
+            uint32_t transferQueueFamily
         );
 
         // Remove Copying Semantics
@@ -48,8 +68,20 @@ class VulkanDevice
         // Queues
         VkQueue m_graphicsQueue = VK_NULL_HANDLE;
         VkQueue m_presentQueue  = VK_NULL_HANDLE;
+        VkQueue m_transferQueue = VK_NULL_HANDLE;
 
         // Queue Families
         uint32_t m_graphicsQueueFamily = UINT32_MAX;
         uint32_t m_presentQueueFamily  = UINT32_MAX;
+        uint32_t m_transferQueueFamily = UINT32_MAX;
+
+        bool m_maintenance5Enabled       = false;
+        bool m_dynamicRenderingEnabled   = false;
+        bool m_synchronization2Enabled   = false;
+        bool m_pipelineStatisticsEnabled = false;
+        bool m_memoryBudgetEnabled       = false;
+
+        // Caches
+        std::unique_ptr<VulkanLayoutCache>       m_layoutCache;
+        std::unique_ptr<VulkanShaderModuleCache> m_shaderModuleCache;
 };
@@ -14,15 +14,19 @@ class VulkanInstance
             const std::string &appName,
             uint32_t          appVersion,
             const std::string &engineName,
-            uint32_t          engineVersion
+            uint32_t          engineVersion,
+            bool              headless = false
         );
 
         const VkInstance GetHandle() const { return m_handle; }
 
+        bool IsDebugUtilsEnabled() const { return m_debugUtilsEnabled; }
+
     private:
         VulkanInstance() = default;
         VulkanInstance(
-            VkInstance handle
+            VkInstance handle,
+            bool       debugUtilsEnabled
         );
 
         // Remove Copying Semantics
@@ -36,4 +40,6 @@ class VulkanInstance
         void Cleanup();
 
         VkInstance m_handle = VK_NULL_HANDLE;
+
+        bool m_debugUtilsEnabled = false;
 };
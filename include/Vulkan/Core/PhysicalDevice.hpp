@@ -10,6 +10,9 @@ struct QueueFamilyIndices {
     std::optional<uint32_t> graphicsFamily;
     std::optional<uint32_t> presentFamily;
 
+    // Transfer Without Graphics, Optional
+    std::optional<uint32_t> transferFamily;
+
     bool isComplete() const {
         return graphicsFamily.has_value() && presentFamily.has_value();
     }
@@ -21,9 +24,10 @@ class VulkanSurface;
 class VulkanPhysicalDevice
 {
     public:
+        // A Null Surface Accepts any Device with a Graphics Queue, Software Rasterizers Included
         static std::unique_ptr<VulkanPhysicalDevice> Create(
             const VulkanInstance &instance,
-            const VulkanSurface  &surface
+            const VulkanSurface  *surface
         );
 
         ~VulkanPhysicalDevice();
@@ -33,12 +37,19 @@ class VulkanPhysicalDevice
         const uint32_t GetGraphicsQueueFamily() const { return m_graphicsQueueFamily; }
         const uint32_t GetPresentQueueFamily()  const { return m_presentQueueFamily;  }
 
+        // The Graphics Family when there is No Transfer-Only Family or ENABLE_TRANSFER_QUEUE is Off
+        const uint32_t GetTransferQueueFamily() const { return m_transferQueueFamily; }
+
+        // Highest Count Not Above the Request that Color and Depth Attachments Both Support
+        VkSampleCountFlagBits ClampSampleCount(uint32_t requestedSamples) const;
+
     private:
         VulkanPhysicalDevice() = default;
         VulkanPhysicalDevice(
             VkPhysicalDevice handle,
             uint32_t         graphicsQueueFamily,
-            uint32_t         presentQueueFamily
+            uint32_t         presentQueueFamily,
+            uint32_t         transferQueueFamily
         );
 
         // Remove Copying Semantics
@@ -57,4 +68,5 @@ class VulkanPhysicalDevice
         // Queue Families
         uint32_t m_graphicsQueueFamily = VK_QUEUE_FAMILY_IGNORED;
         uint32_t m_presentQueueFamily  = VK_QUEUE_FAMILY_IGNORED;
+        uint32_t m_transferQueueFamily = VK_QUEUE_FAMILY_IGNORED;
 };
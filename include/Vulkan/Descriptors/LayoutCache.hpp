@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+struct VulkanDescriptorSetLayoutKey
+{
+    std::vector<VkDescriptorSetLayoutBinding> bindings;
+
+    bool operator==(const VulkanDescriptorSetLayoutKey &other) const;
+};
+
+struct VulkanPipelineLayoutKey
+{
+    std::vector<VkDescriptorSetLayout> setLayouts;
+    std::vector<VkPushConstantRange>   pushConstantRanges;
+
+    bool operator==(const VulkanPipelineLayoutKey &other) const;
+};
+
+struct VulkanDescriptorSetLayoutKeyHash
+{
+    size_t operator()(const VulkanDescriptorSetLayoutKey &key) const;
+};
+
+struct VulkanPipelineLayoutKeyHash
+{
+    size_t operator()(const VulkanPipelineLayoutKey &key) const;
+};
+
+// Device Level Cache, Identical Descriptions Return the Same Handle
+class VulkanLayoutCache
+{
+    public:
+        ~VulkanLayoutCache();
+
+        static std::unique_ptr<VulkanLayoutCache> Create(VkDevice device);
+
+        VkDescriptorSetLayout GetDescriptorSetLayout(
+            const std::vector<VkDescriptorSetLayoutBinding> &bindings
+        );
+        VkPipelineLayout GetPipelineLayout(
+            const std::vector<VkDescriptorSetLayout> &setLayouts,
+            const std::vector<VkPushConstantRange>   &pushConstantRanges = {}
+        );
+
+        // Bindings a Cached Descriptor Set Layout was Created From
+        std::vector<VkDescriptorSetLayoutBinding> GetDescriptorSetLayoutBindings(
+            VkDescriptorSetLayout setLayout
+        );
+
+        // Getters
+        size_t GetDescriptorSetLayoutCount() const { return m_descriptorSetLayouts.size(); }
+        size_t GetPipelineLayoutCount()      const { return m_pipelineLayouts.size(); }
+
+    private:
+        VulkanLayoutCache(VkDevice device);
+
+        // Remove Copying Semantics
+        VulkanLayoutCache(const VulkanLayoutCache&) = delete;
+        VulkanLayoutCache& operator=(const VulkanLayoutCache&) = delete;
+
+        void Cleanup();
+
+        VkDevice m_device = VK_NULL_HANDLE;
+
+        std::mutex m_mutex;
+
+        std::unordered_map<VulkanDescriptorSetLayoutKey, VkDescriptorSetLayout, VulkanDescriptorSetLayoutKeyHash> m_descriptorSetLayouts;
+        std::unordered_map<VulkanPipelineLayoutKey,      VkPipelineLayout,      VulkanPipelineLayoutKeyHash>      m_pipelineLayouts;
+};
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include <vulkan/vulkan.h>
@@ -11,21 +15,81 @@ class VulkanSwapchain;
 class VulkanRenderPass;
 class VulkanSync;
 
-class VulkanShaderModule;
+// 32-Bit Constant Baked into the Shader Stages it is Set On
+struct VulkanSpecializationConstant
+{
+    VkShaderStageFlags stageFlags = 0;
+    uint32_t           constantId = 0;
+    uint32_t           value      = 0;
+
+    bool operator==(const VulkanSpecializationConstant &other) const = default;
+};
+
+// Everything Needed to (Re)Build a Graphics Pipeline
+struct VulkanPipelineDesc
+{
+    std::string vertexShaderPath;
+    std::string pixelShaderPath;
+
+    std::vector<VkVertexInputBindingDescription> bindingDescs;
+
+    // Offset of Each Vertex Input within Binding 0 in Location Order, Taken from the C++ Struct with offsetof
+    // Empty to Require the Inputs be Tightly Packed with no Padding
+    std::vector<uint32_t> attributeOffsets;
+
+    // Empty to Build Set Layouts from Shader Reflection
+    std::vector<VkDescriptorSetLayout> setLayouts;
+
+    // Sorted by Constant ID
+    std::vector<VulkanSpecializationConstant> specializationConstants;
+
+    // Attachment Formats, Used Instead of a Render Pass with Dynamic Rendering
+    std::vector<VkFormat> colorFormats;
+    VkFormat              depthFormat = VK_FORMAT_UNDEFINED;
+
+    // Must Match the Sample Count of the Attachments it Renders To
+    VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+
+    template<typename T>
+    void SetSpecializationConstant(VkShaderStageFlags stageFlags, uint32_t constantId, T value)
+    {
+        static_assert(
+            std::is_same_v<T, bool> || (std::is_arithmetic_v<T> && sizeof(T) == sizeof(uint32_t)),
+            "Specialization Constants must be bool or a 32-Bit Scalar."
+        );
+
+        uint32_t bits = 0;
+        if constexpr (std::is_same_v<T, bool>)
+            bits = value ? VK_TRUE : VK_FALSE;
+        else
+            std::memcpy(&bits, &value, sizeof(bits));
+
+        SetSpecializationConstantBits(stageFlags, constantId, bits);
+    }
+
+    void SetSpecializationConstantBits(VkShaderStageFlags stageFlags, uint32_t constantId, uint32_t bits);
+
+    bool operator==(const VulkanPipelineDesc &other) const;
+};
+
+struct VulkanPipelineDescHash
+{
+    size_t operator()(const VulkanPipelineDesc &desc) const;
+};
 
 class VulkanPipeline
 {
     public:
         ~VulkanPipeline();
 
+        // A Null Render Pass Builds the Pipeline for Dynamic Rendering
         static std::unique_ptr<VulkanPipeline> Create(
             const VulkanDevice     &device,
             const VulkanSwapchain  &swapchain,
-            const VulkanRenderPass &renderPass,
-            std::vector<VkVertexInputBindingDescription>   &bindingDescs,
-            std::vector<VkVertexInputAttributeDescription> &attrDescs,
-            std::vector<VkDescriptorSetLayout>             &layoutDescs,
-            uint32_t frameCount
+            const VulkanRenderPass *renderPass,
+            const VulkanPipelineDesc &desc,
+            uint32_t        frameCount,
+            VkPipelineCache pipelineCache = VK_NULL_HANDLE
         );
 
         void Bind(
@@ -33,16 +97,22 @@ class VulkanPipeline
             const std::vector<VkDescriptorSet> &vkDescriptorSets
         );
 
+        // Without a Render Pass Only Acquires, the Render Graph Records Attachments
         uint32_t BeginFrame(
             const VulkanSwapchain  &swapchain,
-            const VulkanRenderPass &renderPass,
+            const VulkanRenderPass *renderPass,
             const VulkanSync       &sync,
             VkCommandBuffer vkCommandBuffer,
             uint32_t        currentFrame
         );
+        // Separate from EndFrame so Copies can be Recorded after the Render Pass
+        void EndRenderPass(
+            const VulkanRenderPass *renderPass,
+            VkCommandBuffer vkCommandBuffer
+        );
         void EndFrame(
-            const VulkanSwapchain &swapchain,
-            const VulkanSync      &sync,
+            const VulkanSwapchain  &swapchain,
+            VulkanSync             &sync,
             VkCommandBuffer vkCommandBuffer,
             uint32_t        currentFrame,
             uint32_t        imageIndex
@@ -56,9 +126,7 @@ class VulkanPipeline
         VulkanPipeline(
             const VulkanDevice &device,
             VkPipeline       handle,
-            VkPipelineLayout layout,
-            std::unique_ptr<VulkanShaderModule> vertexShaderModule,
-            std::unique_ptr<VulkanShaderModule> pixelShaderModule
+            VkPipelineLayout layout
         );
 
         // Remove Copying Semantics
@@ -75,8 +143,4 @@ class VulkanPipeline
 
         VkPipeline       m_handle = VK_NULL_HANDLE;
         VkPipelineLayout m_layout = VK_NULL_HANDLE;
-
-        // Shader Modules
-        std::unique_ptr<VulkanShaderModule> m_vertexShaderModule;
-        std::unique_ptr<VulkanShaderModule> m_pixelShaderModule;
 };
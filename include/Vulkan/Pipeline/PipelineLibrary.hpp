@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "Vulkan/Pipeline/Pipeline.hpp"
+
+class VulkanDevice;
+class VulkanSwapchain;
+class VulkanRenderPass;
+
+class ShaderWatcher;
+
+using VulkanPipelineHandle = uint32_t;
+
+// Owns Graphics Pipelines, Rebuilding them in the Background when their Shaders Change
+class VulkanPipelineLibrary
+{
+    public:
+        ~VulkanPipelineLibrary();
+
+        // A Null Render Pass Builds Every Pipeline for Dynamic Rendering
+        static std::unique_ptr<VulkanPipelineLibrary> Create(
+            const VulkanDevice     &device,
+            const VulkanSwapchain  &swapchain,
+            const VulkanRenderPass *renderPass,
+            const std::string      &shaderDirectory,
+            const std::string      &pipelineCachePath,
+            bool     hotReload,
+            uint32_t frameCount
+        );
+
+        // Identical Descriptions, Including Specialization, Share One Pipeline
+        VulkanPipelineHandle Add(const VulkanPipelineDesc &desc);
+
+        // Call at a Frame Boundary, after the Frame's Fence has been Waited On
+        void Update(uint64_t frameNumber);
+
+        VulkanPipeline& Get(VulkanPipelineHandle handle) const;
+
+        // Copy of the Description, to Derive Variants From
+        VulkanPipelineDesc GetDesc(VulkanPipelineHandle handle);
+
+        // Release Shader Modules once a Batch of Pipelines has been Added
+        void Trim();
+
+        size_t GetPipelineCount() const { return m_entries.size(); }
+
+    private:
+        VulkanPipelineLibrary(
+            const VulkanDevice     &device,
+            const VulkanSwapchain  &swapchain,
+            const VulkanRenderPass *renderPass,
+            VkPipelineCache pipelineCache,
+            std::string     pipelineCachePath,
+            std::unique_ptr<ShaderWatcher> watcher,
+            uint32_t frameCount
+        );
+
+        // Remove Copying Semantics
+        VulkanPipelineLibrary(const VulkanPipelineLibrary&) = delete;
+        VulkanPipelineLibrary& operator=(const VulkanPipelineLibrary&) = delete;
+
+        void WatchShaders();
+        void SavePipelineCache();
+
+        void Cleanup();
+
+        struct Entry
+        {
+            VulkanPipelineDesc              desc;
+            std::unique_ptr<VulkanPipeline> pipeline;
+        };
+
+        struct PendingSwap
+        {
+            VulkanPipelineHandle            handle;
+            std::unique_ptr<VulkanPipeline> pipeline;
+        };
+
+        struct RetiredPipeline
+        {
+            uint64_t                        frameNumber;
+            std::unique_ptr<VulkanPipeline> pipeline;
+        };
+
+        const VulkanDevice     &m_device;
+        const VulkanSwapchain  &m_swapchain;
+        const VulkanRenderPass *m_renderPass = nullptr;
+
+        uint32_t m_frameCount = 0;
+
+        // Persisted Across Runs so Unchanged Pipelines Skip Compilation
+        VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+        std::string     m_pipelineCachePath;
+
+        // Guards Entry Descriptions and Pending Swaps
+        std::mutex m_mutex;
+
+        std::vector<Entry>           m_entries;
+        std::unordered_map<VulkanPipelineDesc, VulkanPipelineHandle, VulkanPipelineDescHash> m_handles;
+        std::vector<PendingSwap>     m_pendingSwaps;
+        std::vector<RetiredPipeline> m_retiredPipelines;
+
+        // Hot Reload
+        std::unique_ptr<ShaderWatcher> m_watcher;
+        std::atomic<bool>              m_running = false;
+        std::thread                    m_thread;
+};
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <vulkan/vulkan.h>
 
+#include "Vulkan/Pipeline/ShaderReflection.hpp"
+
 class VulkanDevice;
 
 class VulkanShaderModule
@@ -12,17 +16,28 @@ class VulkanShaderModule
     public:
         ~VulkanShaderModule();
 
+        // Without a Handle the Code is Passed Inline at Pipeline Creation (VK_KHR_maintenance5)
         static std::unique_ptr<VulkanShaderModule> Create(
             const VulkanDevice &device,
-            const std::string &filePath
+            std::vector<uint32_t> code,
+            bool createHandle = true
         );
 
+        static std::vector<uint32_t> ReadCode(const std::string &filePath);
+
         const VkShaderModule GetHandle() const { return m_handle; }
 
+        const std::vector<uint32_t>& GetCode() const { return m_code; }
+        VkShaderModuleCreateInfo     GetCreateInfo() const;
+
+        const VulkanShaderReflection& GetReflection() const { return m_reflection; }
+
     private:
         VulkanShaderModule(
             const VulkanDevice &device,
-            VkShaderModule m_handle
+            VkShaderModule m_handle,
+            std::vector<uint32_t>  code,
+            VulkanShaderReflection reflection
         );
 
         // Remove Copying Semantics
@@ -38,4 +53,7 @@ class VulkanShaderModule
         const VulkanDevice &m_device;
 
         VkShaderModule m_handle = VK_NULL_HANDLE;
+
+        std::vector<uint32_t>  m_code;
+        VulkanShaderReflection m_reflection;
 };
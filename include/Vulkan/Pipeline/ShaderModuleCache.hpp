@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+class VulkanDevice;
+class VulkanShaderModule;
+
+// Device Level Cache, Identical SPIR-V Shares One Module Regardless of its Path
+// Modules are Found by Hash and Confirmed by Comparing Code, so Colliding Hashes Keep Separate Modules
+class VulkanShaderModuleCache
+{
+    public:
+        ~VulkanShaderModuleCache();
+
+        static std::unique_ptr<VulkanShaderModuleCache> Create(
+            const VulkanDevice &device,
+            bool inlineCode
+        );
+
+        // Re-Reads the File Only when its Timestamp or Size Changed
+        std::shared_ptr<const VulkanShaderModule> Load(const std::string &filePath);
+
+        // Destroys Modules no Pipeline Build is Using, Call once Pipelines are Created
+        void Trim();
+
+        // Getters
+        size_t GetModuleCount() const { return m_modules.size(); }
+        bool   IsInlineCode()   const { return m_inlineCode; }
+
+    private:
+        VulkanShaderModuleCache(
+            const VulkanDevice &device,
+            bool inlineCode
+        );
+
+        // Remove Copying Semantics
+        VulkanShaderModuleCache(const VulkanShaderModuleCache&) = delete;
+        VulkanShaderModuleCache& operator=(const VulkanShaderModuleCache&) = delete;
+
+        struct FileState
+        {
+            std::filesystem::file_time_type timestamp;
+            uintmax_t                       size = 0;
+            uint64_t                        hash = 0;
+
+            // Which of the Modules Sharing the Hash the File Loaded, Only Compared, Never Dereferenced
+            const VulkanShaderModule *module = nullptr;
+        };
+
+        // The Module Loaded for a Hash, End if it has been Trimmed
+        std::unordered_multimap<uint64_t, std::shared_ptr<const VulkanShaderModule>>::iterator FindModule(
+            uint64_t hash,
+            const VulkanShaderModule *module
+        );
+
+        const VulkanDevice &m_device;
+
+        bool m_inlineCode = false;
+
+        std::mutex m_mutex;
+
+        std::unordered_multimap<uint64_t, std::shared_ptr<const VulkanShaderModule>> m_modules;
+        std::unordered_map<std::string, FileState>                                  m_files;
+};
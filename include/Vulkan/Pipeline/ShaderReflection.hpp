@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+struct VulkanShaderInput
+{
+    uint32_t    location = 0;
+    VkFormat    format   = VK_FORMAT_UNDEFINED;
+    uint32_t    size     = 0;
+    std::string name;
+};
+
+struct VulkanShaderDescriptorBinding
+{
+    uint32_t         set     = 0;
+    uint32_t         binding = 0;
+    VkDescriptorType type    = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+    uint32_t         count   = 1;
+    std::string      name;
+};
+
+// Interface of a Single SPIR-V Entry Point, Parsed Directly from the Module Words
+struct VulkanShaderReflection
+{
+    VkShaderStageFlagBits stage = VK_SHADER_STAGE_ALL;
+    std::string           entryPoint;
+
+    std::vector<VulkanShaderInput>             inputs;
+    std::vector<VulkanShaderDescriptorBinding> descriptorBindings;
+    std::vector<VkPushConstantRange>           pushConstantRanges;
+    std::vector<uint32_t>                      specializationConstantIds;
+
+    std::array<uint32_t, 3> workgroupSize{0, 0, 0};
+
+    static VulkanShaderReflection Reflect(const uint32_t *code, size_t wordCount);
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Reports SPIR-V Files Rewritten in a Directory, inotify on Linux and Polling Elsewhere
+class ShaderWatcher
+{
+    public:
+        ~ShaderWatcher();
+
+        static std::unique_ptr<ShaderWatcher> Create(const std::string &directory);
+
+        // Blocks up to the Timeout, Returns Normalized Paths of Changed Files
+        std::vector<std::string> WaitForChanges(std::chrono::milliseconds timeout);
+
+    private:
+        ShaderWatcher(
+            std::filesystem::path directory,
+            int inotifyHandle,
+            int watchHandle
+        );
+
+        // Remove Copying Semantics
+        ShaderWatcher(const ShaderWatcher&) = delete;
+        ShaderWatcher& operator=(const ShaderWatcher&) = delete;
+
+        std::vector<std::string> ReadEvents(std::chrono::milliseconds timeout);
+        std::vector<std::string> PollTimestamps(std::chrono::milliseconds timeout);
+
+        void Cleanup();
+
+        std::filesystem::path m_directory;
+
+        // inotify, -1 when Falling Back to Polling
+        int m_inotifyHandle = -1;
+        int m_watchHandle   = -1;
+
+        std::unordered_map<std::string, std::filesystem::file_time_type> m_timestamps;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+class VulkanPhysicalDevice;
+class VulkanDevice;
+
+// Rolling GPU Time of One Named Scope, in Milliseconds
+struct VulkanGpuScopeStats
+{
+    std::string name;
+
+    double last = 0.0;
+    double min  = 0.0;
+    double avg  = 0.0;
+    double max  = 0.0;
+
+    // Most Recent Samples, Oldest Overwritten First
+    std::vector<double> history;
+    size_t              cursor = 0;
+};
+
+// Timestamp Queries Around Named Scopes, Read Back once the Frame's Fence has Signaled
+class VulkanGpuProfiler
+{
+    public:
+        ~VulkanGpuProfiler();
+
+        // Null when the Graphics Queue Cannot Write Timestamps
+        static std::unique_ptr<VulkanGpuProfiler> Create(
+            const VulkanPhysicalDevice &physicalDevice,
+            const VulkanDevice         &device,
+            uint32_t frameCount,
+            uint32_t maxScopes = 64
+        );
+
+        // Call after the Frame's Fence Wait and Outside any Render Pass, Collects then Resets the Frame's Queries
+        void BeginFrame(VkCommandBuffer commandBuffer, uint32_t currentFrame);
+
+        // Scopes may Nest, Scopes Past the Frame's Limit are Dropped
+        uint32_t BeginScope(VkCommandBuffer commandBuffer, const std::string &name);
+        void     EndScope(VkCommandBuffer commandBuffer, uint32_t scope);
+
+        // Call Right After the Frame is Submitted, Anchors its Scopes on the CPU Trace Timeline
+        void MarkSubmitted(uint32_t currentFrame);
+
+        // Ordered by First Appearance
+        const std::vector<VulkanGpuScopeStats>& GetScopes() const { return m_scopes; }
+
+    private:
+        struct FrameScope
+        {
+            uint32_t stats      = 0;
+            uint32_t queryIndex = 0;
+        };
+
+        struct Frame
+        {
+            VkQueryPool             queryPool = VK_NULL_HANDLE;
+            std::vector<FrameScope> scopes;
+
+            // Scopes Recorded Since the Last Collect
+            bool isPending = false;
+
+            // CPU Profiler Time of the Submit, the GPU Starts No Earlier
+            uint64_t submitTime = 0;
+        };
+
+        VulkanGpuProfiler(
+            const VulkanDevice &device,
+            std::vector<Frame> frames,
+            uint32_t maxScopes,
+            double   timestampPeriod,
+            uint64_t timestampMask
+        );
+
+        // Remove Copying Semantics
+        VulkanGpuProfiler(const VulkanGpuProfiler&) = delete;
+        VulkanGpuProfiler& operator=(const VulkanGpuProfiler&) = delete;
+
+        void Collect(Frame &frame);
+        void AddSample(VulkanGpuScopeStats &stats, double milliseconds);
+
+        void WriteTimestamp(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, bool isEnd);
+
+        void Cleanup();
+
+        const VulkanDevice &m_device;
+
+        std::vector<Frame> m_frames;
+        uint32_t           m_currentFrame = 0;
+        uint32_t           m_maxScopes    = 0;
+
+        // Readback Scratch for One Frame's Queries
+        std::vector<uint64_t> m_timestamps;
+
+        // Nanoseconds per Tick, and the Bits the Queue Actually Writes
+        double   m_timestampPeriod = 1.0;
+        uint64_t m_timestampMask   = UINT64_MAX;
+
+        std::vector<VulkanGpuScopeStats>          m_scopes;
+        std::unordered_map<std::string, uint32_t> m_scopeIndices;
+
+        // Interned Scope Names for the CPU Profiler's Trace
+        std::vector<const char*> m_traceNames;
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+class VulkanDevice;
+
+// Counters of One Named Scope from the Last Collected Frame
+struct VulkanPipelineStatisticsResult
+{
+    std::string name;
+
+    uint64_t inputAssemblyVertices     = 0;
+    uint64_t inputAssemblyPrimitives   = 0;
+    uint64_t vertexShaderInvocations   = 0;
+    uint64_t clippingInvocations       = 0;
+    uint64_t clippingPrimitives        = 0;
+    uint64_t fragmentShaderInvocations = 0;
+};
+
+// Pipeline Statistics Queries Around Named Scopes, Read Back once the Frame's Fence has Signaled
+class VulkanPipelineStatistics
+{
+    public:
+        ~VulkanPipelineStatistics();
+
+        // Null when the Device does not Support Pipeline Statistics Queries
+        static std::unique_ptr<VulkanPipelineStatistics> Create(
+            const VulkanDevice &device,
+            uint32_t frameCount,
+            uint32_t maxScopes = 16
+        );
+
+        // Call after the Frame's Fence Wait and Outside any Render Pass, Collects then Resets the Frame's Queries
+        void BeginFrame(VkCommandBuffer commandBuffer, uint32_t currentFrame);
+
+        // Scopes cannot Nest, a Scope Begun while Another is Open is Dropped
+        // Inside a Render Pass a Scope must End in the Subpass it Began In
+        uint32_t BeginScope(VkCommandBuffer commandBuffer, const std::string &name);
+        void     EndScope(VkCommandBuffer commandBuffer, uint32_t scope);
+
+        // Ordered by First Appearance
+        const std::vector<VulkanPipelineStatisticsResult>& GetResults() const { return m_results; }
+
+    private:
+        struct FrameScope
+        {
+            uint32_t result = 0;
+            uint32_t query  = 0;
+        };
+
+        struct Frame
+        {
+            VkQueryPool             queryPool = VK_NULL_HANDLE;
+            std::vector<FrameScope> scopes;
+
+            // Scopes Recorded Since the Last Collect
+            bool isPending = false;
+        };
+
+        VulkanPipelineStatistics(
+            const VulkanDevice &device,
+            std::vector<Frame> frames,
+            uint32_t maxScopes
+        );
+
+        // Remove Copying Semantics
+        VulkanPipelineStatistics(const VulkanPipelineStatistics&) = delete;
+        VulkanPipelineStatistics& operator=(const VulkanPipelineStatistics&) = delete;
+
+        void Collect(Frame &frame);
+
+        void Cleanup();
+
+        const VulkanDevice &m_device;
+
+        std::vector<Frame> m_frames;
+        uint32_t           m_currentFrame = 0;
+        uint32_t           m_maxScopes    = 0;
+        bool               m_isScopeOpen  = false;
+
+        // Readback Scratch for One Frame's Queries
+        std::vector<uint64_t> m_counters;
+
+        std::vector<VulkanPipelineStatisticsResult> m_results;
+        std::unordered_map<std::string, uint32_t>   m_resultIndices;
+};
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "Memory/Pool.hpp"
+
+struct VulkanMemoryAllocation;
+using VulkanAllocationHandle = PoolHandle<VulkanMemoryAllocation>;
+
+class VulkanPhysicalDevice;
+class VulkanDevice;
+class VulkanMemoryAllocator;
+class VulkanImage;
+class VulkanImageView;
+class VulkanGpuProfiler;
+class VulkanPipelineStatistics;
+
+using VulkanRenderGraphResource = uint32_t;
+
+// How a Pass Touches a Resource, Decides its Layout, Stages and Access
+enum class VulkanRenderGraphUsage
+{
+    ColorAttachment,
+    DepthAttachment,
+    DepthRead,
+    Sampled,
+    TransferSrc,
+    TransferDst
+};
+
+class VulkanRenderGraphPass
+{
+    public:
+        VulkanRenderGraphPass& Read(VulkanRenderGraphResource resource, VulkanRenderGraphUsage usage);
+        VulkanRenderGraphPass& Write(VulkanRenderGraphResource resource, VulkanRenderGraphUsage usage);
+
+        // Cleared Attachments Never Load their Previous Contents
+        VulkanRenderGraphPass& ClearColor(VulkanRenderGraphResource resource, VkClearColorValue value);
+        VulkanRenderGraphPass& ClearDepth(VulkanRenderGraphResource resource, float depth);
+
+        // Averages a Multisampled Color Attachment of this Pass into the Target
+        VulkanRenderGraphPass& ResolveColor(VulkanRenderGraphResource source, VulkanRenderGraphResource target);
+
+        // Passes with Side Effects are Kept Even when Nothing Reads their Output
+        VulkanRenderGraphPass& SetSideEffects();
+
+        // Recorded Inside the Pass, Attachments are Already Bound
+        VulkanRenderGraphPass& SetExecute(std::function<void(VkCommandBuffer)> execute);
+
+        const std::string& GetName() const { return m_name; }
+
+    private:
+        friend class VulkanRenderGraph;
+
+        explicit VulkanRenderGraphPass(std::string name);
+
+        struct Access
+        {
+            VulkanRenderGraphResource resource = 0;
+            VulkanRenderGraphUsage    usage    = VulkanRenderGraphUsage::Sampled;
+            bool         isWrite = false;
+            bool         isClear = false;
+            VkClearValue clearValue{};
+
+            std::optional<VulkanRenderGraphResource> resolveSource;
+        };
+
+        Access& AddAccess(VulkanRenderGraphResource resource, VulkanRenderGraphUsage usage, bool isWrite);
+
+        std::string m_name;
+
+        std::vector<Access> m_accesses;
+        bool                m_hasSideEffects = false;
+
+        std::function<void(VkCommandBuffer)> m_execute;
+};
+
+// Frame Graph, Passes Declare Accesses and the Graph Derives Barriers and Memory
+class VulkanRenderGraph
+{
+    public:
+        ~VulkanRenderGraph();
+
+        static std::unique_ptr<VulkanRenderGraph> Create(
+            const VulkanPhysicalDevice &physicalDevice,
+            const VulkanDevice         &device,
+            VulkanMemoryAllocator      &allocator
+        );
+
+        // Owned Elsewhere, Rebound with SetImportedImage Before Every Execute
+        VulkanRenderGraphResource ImportImage(
+            const std::string &name,
+            VkFormat      format,
+            VkExtent2D    extent,
+            VkImageLayout initialLayout,
+            VkImageLayout finalLayout
+        );
+
+        // Owned by the Graph, Memory is Shared with Images that are Never Live Together
+        VulkanRenderGraphResource CreateImage(
+            const std::string &name,
+            VkFormat   format,
+            VkExtent2D extent,
+            VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT
+        );
+
+        VulkanRenderGraphPass& AddPass(const std::string &name);
+
+        // Culls Unused Passes, Plans Barriers and Allocates Transient Memory
+        void Compile();
+
+        void SetImportedImage(VulkanRenderGraphResource resource, VkImage image, VkImageView view);
+        // Per-Pass Scratch Comes from the Arena, Nothing Allocated Outlives the Call
+        void Execute(
+            VkCommandBuffer            commandBuffer,
+            std::pmr::memory_resource *arena = std::pmr::get_default_resource()
+        ) const;
+
+        // Times Every Executed Pass, Including its Barriers, Under the Pass's Name
+        void SetProfiler(VulkanGpuProfiler *profiler) { m_profiler = profiler; }
+
+        // Counts Every Executed Pass's Work Under the Pass's Name, Null to Stop Counting
+        void SetPipelineStatistics(VulkanPipelineStatistics *statistics) { m_statistics = statistics; }
+
+        // Getters
+        size_t       GetPassCount()           const { return m_passes.size(); }
+        size_t       GetCompiledPassCount()   const { return m_compiledPasses.size(); }
+        VkDeviceSize GetTransientMemorySize() const;
+
+    private:
+        VulkanRenderGraph(
+            const VulkanPhysicalDevice &physicalDevice,
+            const VulkanDevice         &device,
+            VulkanMemoryAllocator      &allocator
+        );
+
+        // Remove Copying Semantics
+        VulkanRenderGraph(const VulkanRenderGraph&) = delete;
+        VulkanRenderGraph& operator=(const VulkanRenderGraph&) = delete;
+
+        struct Resource
+        {
+            std::string name;
+
+            VkFormat          format = VK_FORMAT_UNDEFINED;
+            VkExtent2D        extent{0, 0};
+            VkImageUsageFlags usage  = 0;
+
+            VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+
+            bool          isImported    = false;
+            VkImageLayout initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            VkImageLayout finalLayout   = VK_IMAGE_LAYOUT_UNDEFINED;
+
+            VkImage     image = VK_NULL_HANDLE;
+            VkImageView view  = VK_NULL_HANDLE;
+
+            std::unique_ptr<VulkanImage>     transientImage;
+            std::unique_ptr<VulkanImageView> transientView;
+
+            // Lifetime in Compiled Pass Order
+            uint32_t firstPass = UINT32_MAX;
+            uint32_t lastPass  = 0;
+
+            // Stages and Access of the Final Use, for the Next User of the Memory
+            VkPipelineStageFlags2 lastStages = 0;
+            VkAccessFlags2        lastAccess = 0;
+        };
+
+        struct Barrier
+        {
+            VulkanRenderGraphResource resource = 0;
+
+            VkImageLayout         oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            VkImageLayout         newLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            VkPipelineStageFlags2 srcStages = 0;
+            VkAccessFlags2        srcAccess = 0;
+            VkPipelineStageFlags2 dstStages = 0;
+            VkAccessFlags2        dstAccess = 0;
+        };
+
+        struct Attachment
+        {
+            VulkanRenderGraphResource resource = 0;
+
+            VkImageLayout       layout  = VK_IMAGE_LAYOUT_UNDEFINED;
+            VkAttachmentLoadOp  loadOp  = VK_ATTACHMENT_LOAD_OP_LOAD;
+            VkAttachmentStoreOp storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+            VkClearValue        clearValue{};
+
+            std::optional<VulkanRenderGraphResource> resolveTarget;
+        };
+
+        struct CompiledPass
+        {
+            const VulkanRenderGraphPass *pass = nullptr;
+
+            std::vector<Barrier> barriers;
+
+            std::vector<Attachment>   colorAttachments;
+            std::optional<Attachment> depthAttachment;
+            VkExtent2D                renderArea{0, 0};
+        };
+
+        // Transient Images Share a Slot when their Lifetimes do not Overlap
+        struct MemorySlot
+        {
+            VkDeviceSize size           = 0;
+            VkDeviceSize alignment      = 1;
+            uint32_t     memoryTypeBits = 0;
+            uint32_t     lastPass       = 0;
+
+            // Attachment-Only Images Never Need Backing on Tiled GPUs
+            bool isLazy = false;
+
+            std::vector<VulkanRenderGraphResource> resources;
+            VulkanAllocationHandle                 allocation = {};
+        };
+
+        std::vector<const VulkanRenderGraphPass*> CullPasses() const;
+        void AllocateTransients();
+        void PlanBarriers();
+
+        void RecordBarriers(VkCommandBuffer commandBuffer, const std::vector<Barrier> &barriers, std::pmr::memory_resource *arena) const;
+        void ExecutePass(VkCommandBuffer commandBuffer, const CompiledPass &compiled, std::pmr::memory_resource *arena) const;
+
+        void ReleaseTransients();
+        void Cleanup();
+
+        const VulkanPhysicalDevice &m_physicalDevice;
+        const VulkanDevice         &m_device;
+        VulkanMemoryAllocator      &m_allocator;
+
+        std::vector<Resource>                               m_resources;
+        std::vector<std::unique_ptr<VulkanRenderGraphPass>> m_passes;
+
+        // Compiled State
+        std::vector<CompiledPass> m_compiledPasses;
+        std::vector<Barrier>      m_finalBarriers;
+        std::vector<MemorySlot>   m_memorySlots;
+
+        VulkanGpuProfiler        *m_profiler   = nullptr;
+        VulkanPipelineStatistics *m_statistics = nullptr;
+};
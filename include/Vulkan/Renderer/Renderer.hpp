@@ -1,7 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
+
+#include <vulkan/vulkan.h>
 
 #include "Settings.hpp"
 
@@ -16,31 +21,76 @@ class VulkanSync;
 class VulkanCommandPool;
 class VulkanDescriptorPool;
 class VulkanPipeline;
+class VulkanPipelineLibrary;
+class VulkanRenderGraph;
+class VulkanFrameReadback;
+class VulkanGpuProfiler;
+class VulkanPipelineStatistics;
+class VulkanMesh;
+
+class FrameArena;
+
+struct VulkanReadbackFrame;
+using VulkanReadbackCallback = std::function<void(const VulkanReadbackFrame&)>;
+
+// CPU Timings in Seconds and Counts of the Last Drawn Frame
+struct VulkanRendererStats
+{
+    double waitTime   = 0.0;
+    double recordTime = 0.0;
+    double submitTime = 0.0;
+
+    uint32_t drawCalls = 0;
+    uint32_t instances = 0;
+};
 
 class VulkanRenderer
 {
     public:
         ~VulkanRenderer();
 
-        static std::unique_ptr<VulkanRenderer> Create(const Window &window);
+        // A Null Window Renders Headless into Offscreen Images
+        static std::unique_ptr<VulkanRenderer> Create(const Window *window);
 
         void Finish();
+
+        // Waits for the Current Frame's Fence, after which its Buffers may be Updated
+        void BeginFrame();
+
+        // Records and Submits the Current Frame, Beginning it First if BeginFrame was Not Called
         void Draw();
 
+        // Copies the Next Drawn Frame to the Host, the Callback Runs FRAMES_IN_FLIGHT Frames Later
+        void RequestReadback(VulkanReadbackCallback callback);
+
+        // Counts Shader Invocations and Primitives per Pass, Ignored if the Device Lacks the Feature
+        void SetPipelineStatisticsEnabled(bool enabled);
+
         // Setters
         void SetScene(std::shared_ptr<VulkanScene> scene);
 
         // Getters
         const VulkanContext&         GetContext()         const { return *m_context; }
         const VulkanSwapchain&       GetSwapchain()       const { return *m_swapchain; }
-        const VulkanRenderPass&      GetRenderPass()      const { return *m_renderPass; }
-        const VulkanSync&            GetSync()            const { return *m_sync; }
+        const VulkanRenderPass*      GetRenderPass()      const { return m_renderPass.get(); }
+        VulkanSync&                  GetSync()            const { return *m_sync; }
         const VulkanCommandPool&     GetCommandPool()     const { return *m_commandPool; }
+        const VulkanCommandPool&     GetTransferCommandPool() const { return *m_transferCommandPool; }
         const VulkanDescriptorPool&  GetDescriptorPool()  const { return *m_descriptorPool; }
-        const VulkanPipeline&        GetPipeline()        const { return *m_pipeline; }
+        const VulkanPipeline&        GetPipeline()        const;
+        VulkanPipelineLibrary&       GetPipelineLibrary() const { return *m_pipelineLibrary; }
         VulkanMemoryAllocator&       GetAllocator()       const { return *m_allocator; }
 
-        const uint32_t GetCurrentFrame() const { return m_currentFrame; }
+        const uint32_t GetCurrentFrame()   const { return m_currentFrame; }
+        const uint32_t GetPipelineHandle() const { return m_pipelineHandle; }
+
+        const VulkanRendererStats& GetStats() const { return m_stats; }
+
+        // Null when Disabled or Timestamps are Unsupported
+        const VulkanGpuProfiler* GetGpuProfiler() const { return m_gpuProfiler.get(); }
+
+        // Null Until Pipeline Statistics are First Enabled
+        const VulkanPipelineStatistics* GetPipelineStatistics() const { return m_pipelineStatistics.get(); }
 
     private:
         VulkanRenderer() = default;
@@ -51,9 +101,14 @@ class VulkanRenderer
             std::unique_ptr<VulkanRenderPass>      renderPass,
             std::unique_ptr<VulkanSync>            sync,
             std::unique_ptr<VulkanCommandPool>     commandPool,
-            std::unique_ptr<VulkanDescriptorPool>  descriptorPool
+            std::unique_ptr<VulkanDescriptorPool>  descriptorPool,
+            std::unique_ptr<VulkanPipelineLibrary> pipelineLibrary
         );
 
+        // Passes Capture the Renderer, so the Graph is Built once it has an Address
+        void BuildRenderGraph();
+        void RecordScene(VkCommandBuffer vkCommandBuffer);
+
         // Remove Copying Semantics
         VulkanRenderer(const VulkanRenderer&) = delete;
         VulkanRenderer& operator=(const VulkanRenderer&) = delete;
@@ -66,13 +121,49 @@ class VulkanRenderer
         std::unique_ptr<VulkanContext>         m_context;
         std::unique_ptr<VulkanMemoryAllocator> m_allocator;
         std::unique_ptr<VulkanSwapchain>       m_swapchain;
+        // Null when Rendering Dynamically
         std::unique_ptr<VulkanRenderPass>      m_renderPass;
         std::unique_ptr<VulkanSync>            m_sync;
         std::unique_ptr<VulkanCommandPool>     m_commandPool;
         std::unique_ptr<VulkanDescriptorPool>  m_descriptorPool;
-        std::unique_ptr<VulkanPipeline>        m_pipeline;
+
+        // Uploads, on the Transfer Queue Family when the Device has One
+        std::unique_ptr<VulkanCommandPool>     m_transferCommandPool;
+
+        std::unique_ptr<VulkanPipelineLibrary> m_pipelineLibrary;
+
+        // Null when Rendering through the Render Pass
+        std::unique_ptr<VulkanRenderGraph> m_renderGraph;
+        uint32_t                           m_backbuffer = 0;
+
+        // Only the Render Graph Path Multisamples
+        VkSampleCountFlagBits m_samples = VK_SAMPLE_COUNT_1_BIT;
+
+        // Created on the First Request
+        std::unique_ptr<VulkanFrameReadback> m_readback;
+        VulkanReadbackCallback               m_readbackCallback;
+
+        std::unique_ptr<VulkanGpuProfiler> m_gpuProfiler;
+
+        // Kept when Disabled, Queries of Frames Still in Flight Use its Pools
+        std::unique_ptr<VulkanPipelineStatistics> m_pipelineStatistics;
+        bool                                      m_pipelineStatisticsEnabled = false;
 
         std::shared_ptr<VulkanScene> m_scene;
 
+        VulkanRendererStats m_stats;
+
+        // One per Frame in Flight, Reset once the Frame's Fence has Signaled
+        std::vector<std::unique_ptr<FrameArena>> m_frameArenas;
+
+        // Opaque Draws Sorted Front to Back, Reused Every Frame
+        std::vector<std::pair<float, VulkanMesh*>> m_drawList;
+
+        uint32_t m_pipelineHandle = 0;
+
         uint32_t m_currentFrame = 0;
+        uint64_t m_frameNumber  = 0;
+
+        // Set by BeginFrame Until Draw Submits the Frame
+        bool m_isFrameBegun = false;
 };
\ No newline at end of file
@@ -1,39 +1,58 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include <vulkan/vulkan.h>
 
-using VulkanAllocationHandle = void*;
+#include "Memory/Pool.hpp"
+
+#include "Vulkan/Resources/MemoryAllocator.hpp"
 
 class VulkanPhysicalDevice;
 class VulkanDevice;
 class VulkanMemoryAllocator;
 class VulkanCommandPool;
+class VulkanSync;
 
-class VulkanBuffer
+// Pooled, Handles to a Buffer Resolve to Null once it is Destroyed
+class VulkanBuffer : public Pooled<VulkanBuffer>
 {
     public:
         ~VulkanBuffer();
 
+        // frame is the Frame Slot whose Submits Alone Use the Buffer, Only Such Buffers are Moved by Defragmentation
         static std::unique_ptr<VulkanBuffer> Create(
             const VulkanPhysicalDevice &physicalDevice,
             const VulkanDevice         &device,
             VulkanMemoryAllocator      &allocator,
             VkDeviceSize          size,
             VkBufferUsageFlags    usage,
-            VkMemoryPropertyFlags properties
+            VkMemoryPropertyFlags properties,
+            VulkanMemoryCategory  category = VulkanMemoryCategory::Other,
+            uint32_t              frame    = UINT32_MAX
         );
 
         void Update(
             const void   *data,
             VkDeviceSize size
         );
-        void CopyTo(
+        // Returns without Waiting, the Frame's Next Submit Waits on the Copy
+        // The Source must Not be Rewritten Before sync.WaitForUpload on the Returned Ticket
+        uint64_t CopyTo(
             const VulkanCommandPool &commandPool,
-            const VulkanBuffer      &dst
+            VulkanSync              &sync,
+            const VulkanBuffer      &dst,
+            uint32_t                currentFrame
         );
 
+        // Switches to a New Buffer Bound to newAllocation, the Old Buffer is Destroyed once Unused
+        // The Returned Copy Carries the Contents Over and is Recorded by the Allocator
+        VulkanBufferMove Relocate(VulkanAllocationHandle newAllocation);
+
+        // Called after Relocate Changes the Handle, Descriptors Referencing the Buffer are Patched Here
+        void SetRelocatedCallback(std::function<void(const VulkanBuffer&)> callback) { m_onRelocated = std::move(callback); }
+
         const VkBuffer               GetHandle()           const { return m_handle; }
         const VulkanAllocationHandle GetAllocationHandle() const { return m_allocationHandle; }
         const VkDeviceSize           GetSize()             const { return m_size; }
@@ -65,8 +84,10 @@ class VulkanBuffer
         VulkanMemoryAllocator &m_allocator;
 
         VkBuffer               m_handle           = VK_NULL_HANDLE;
-        VulkanAllocationHandle m_allocationHandle = nullptr;
+        VulkanAllocationHandle m_allocationHandle = {};
         VkDeviceSize           m_size       = 0;
         VkBufferUsageFlags     m_usage      = 0;
         VkMemoryPropertyFlags  m_properties = 0;
+
+        std::function<void(const VulkanBuffer&)> m_onRelocated;
 };
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+class VulkanPhysicalDevice;
+class VulkanDevice;
+class VulkanMemoryAllocator;
+class VulkanBuffer;
+class VulkanImage;
+
+// Tightly Packed Pixels of One Frame, Only Valid During the Callback
+struct VulkanReadbackFrame
+{
+    uint64_t   frameNumber = 0;
+    VkExtent2D extent{0, 0};
+    VkFormat   format      = VK_FORMAT_UNDEFINED;
+    uint32_t   rowPitch    = 0;
+
+    const uint8_t *data = nullptr;
+    size_t         size = 0;
+};
+
+using VulkanReadbackCallback = std::function<void(const VulkanReadbackFrame&)>;
+
+// Ring of Host-Cached Buffers, One per Frame in Flight, Completed by the Frame's Fence
+class VulkanFrameReadback
+{
+    public:
+        ~VulkanFrameReadback();
+
+        static std::unique_ptr<VulkanFrameReadback> Create(
+            const VulkanPhysicalDevice &physicalDevice,
+            const VulkanDevice         &device,
+            VulkanMemoryAllocator      &allocator,
+            VkExtent2D extent,
+            VkFormat   format,
+            uint32_t   frameCount
+        );
+
+        // Copies the Image into the Frame's Slot, the Image is Returned to its Layout Afterwards
+        void Record(
+            VkCommandBuffer    commandBuffer,
+            const VulkanImage  &image,
+            VkImageLayout      layout,
+            uint32_t           currentFrame,
+            uint64_t           frameNumber,
+            VulkanReadbackCallback callback
+        );
+
+        // Call once the Frame's Fence has been Waited On, Delivers the Slot's Pixels
+        void Collect(uint32_t currentFrame);
+
+        // Call after the Device is Idle, Delivers Every Pending Slot
+        void CollectAll();
+
+        bool IsPending(uint32_t currentFrame) const { return static_cast<bool>(m_slots[currentFrame].callback); }
+
+    private:
+        struct Slot
+        {
+            std::unique_ptr<VulkanBuffer> buffer;
+
+            uint64_t               frameNumber = 0;
+            VulkanReadbackCallback callback;
+        };
+
+        VulkanFrameReadback(
+            const VulkanDevice    &device,
+            VulkanMemoryAllocator &allocator,
+            std::vector<Slot>     slots,
+            VkExtent2D extent,
+            VkFormat   format,
+            uint32_t   texelSize
+        );
+
+        // Remove Copying Semantics
+        VulkanFrameReadback(const VulkanFrameReadback&) = delete;
+        VulkanFrameReadback& operator=(const VulkanFrameReadback&) = delete;
+
+        static uint32_t GetTexelSize(VkFormat format);
+
+        void Cleanup();
+
+        const VulkanDevice    &m_device;
+        VulkanMemoryAllocator &m_allocator;
+
+        std::vector<Slot> m_slots;
+
+        VkExtent2D m_extent{0, 0};
+        VkFormat   m_format    = VK_FORMAT_UNDEFINED;
+        uint32_t   m_texelSize = 0;
+};
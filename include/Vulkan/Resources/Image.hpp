@@ -4,13 +4,17 @@
 
 #include <vulkan/vulkan.h>
 
-using VulkanAllocationHandle = void*;
+#include "Memory/Pool.hpp"
+
+struct VulkanMemoryAllocation;
+using VulkanAllocationHandle = PoolHandle<VulkanMemoryAllocation>;
 
 class VulkanPhysicalDevice;
 class VulkanDevice;
 class VulkanMemoryAllocator;
 
-class VulkanImage
+// Pooled, Handles to an Image Resolve to Null once it is Destroyed
+class VulkanImage : public Pooled<VulkanImage>
 {
     public:
         ~VulkanImage();
@@ -29,6 +33,19 @@ class VulkanImage
             VkImage               externalHandle = VK_NULL_HANDLE
         );
 
+        // Image without Memory, Bound Later into an Allocation the Caller Owns
+        static std::unique_ptr<VulkanImage> CreateAliased(
+            const VulkanDevice    &device,
+            VulkanMemoryAllocator &allocator,
+            VkExtent3D        extent,
+            VkFormat          format,
+            VkImageUsageFlags usage,
+            VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT
+        );
+
+        VkMemoryRequirements GetMemoryRequirements() const;
+        void BindMemory(VulkanAllocationHandle allocationHandle);
+
         void TransitionLayout(
             VkCommandBuffer    commandBuffer,
             VkImageLayout      oldLayout,
@@ -81,7 +98,7 @@ class VulkanImage
         VulkanMemoryAllocator &m_allocator;
 
         VkImage                m_handle           = VK_NULL_HANDLE;
-        VulkanAllocationHandle m_allocationHandle = nullptr;
+        VulkanAllocationHandle m_allocationHandle = {};
 
         VkExtent3D            m_extent{0, 0, 0};
         VkFormat              m_format      = VK_FORMAT_UNDEFINED;
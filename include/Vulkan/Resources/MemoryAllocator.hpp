@@ -1,15 +1,114 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <ostream>
+#include <vector>
 
 #include <vulkan/vulkan.h>
 
-using VulkanAllocationHandle = void*;
+#include "Memory/Pool.hpp"
 
 class VulkanPhysicalDevice;
 class VulkanDevice;
 
+struct VulkanMemoryBlock;
+struct VulkanMemoryAllocation;
+
+// Generation-Counted, a Handle Kept after Free Resolves to Nothing Instead of a Reused Allocation
+using VulkanAllocationHandle = PoolHandle<VulkanMemoryAllocation>;
+
+// Copy Defragment Records for a Relocated Buffer, Fenced by Barriers at the Stages the Buffer is Used In
+struct VulkanBufferMove
+{
+    VkBuffer           src   = VK_NULL_HANDLE;
+    VkBuffer           dst   = VK_NULL_HANDLE;
+    VkDeviceSize       size  = 0;
+    VkBufferUsageFlags usage = 0;
+};
+
+// Rebinds the Resource to the New Allocation and Describes the Copy that Carries its Contents Over
+using VulkanRelocateCallback = std::function<VulkanBufferMove(VulkanAllocationHandle newAllocation)>;
+
+// The Single Resource a Dedicated Allocation is Made For, Exactly One Handle is Set
+struct VulkanDedicatedResource
+{
+    VkImage  image  = VK_NULL_HANDLE;
+    VkBuffer buffer = VK_NULL_HANDLE;
+};
+
+// What an Allocation Backs, Used for Accounting and Memory Type Preferences
+enum class VulkanMemoryCategory : uint32_t
+{
+    Other,
+    Mesh,
+    Staging,
+    Uniform,
+    Image,
+
+    Count
+};
+
+const char* getMemoryCategoryName(VulkanMemoryCategory category);
+
+// Types Missing a Required Flag are Never Used, the Others are Ranked by Preferred and Not Preferred Flags
+struct VulkanMemoryPreference
+{
+    VkMemoryPropertyFlags required     = 0;
+    VkMemoryPropertyFlags preferred    = 0;
+    VkMemoryPropertyFlags notPreferred = 0;
+};
+
+// Lazy and Cached Memory are Preferences, the Category Steers Between Heaps
+VulkanMemoryPreference getMemoryPreference(VkMemoryPropertyFlags properties, VulkanMemoryCategory category);
+
+// Allocated is Device Memory Held, Used is the Part Handed Out to Resources
+struct VulkanMemoryUsage
+{
+    VkDeviceSize allocatedBytes  = 0;
+    VkDeviceSize usedBytes       = 0;
+    uint32_t     allocationCount = 0;
+    uint32_t     blockCount      = 0;
+
+    // Share of Allocated Bytes Not Used by any Allocation
+    double GetFragmentation() const
+    {
+        return allocatedBytes > 0 ? 1.0 - static_cast<double>(usedBytes) / static_cast<double>(allocatedBytes) : 0.0;
+    }
+};
+
+struct VulkanMemoryHeapStats
+{
+    VkDeviceSize      size  = 0;
+    VkMemoryHeapFlags flags = 0;
+
+    // From VK_EXT_memory_budget, Estimated from the Heap Size and Own Usage without It
+    VkDeviceSize budget = 0;
+    VkDeviceSize usage  = 0;
+
+    VulkanMemoryUsage allocator;
+};
+
+struct VulkanMemoryTypeStats
+{
+    VkMemoryPropertyFlags flags     = 0;
+    uint32_t              heapIndex = 0;
+
+    VulkanMemoryUsage allocator;
+};
+
+struct VulkanMemoryStats
+{
+    std::vector<VulkanMemoryHeapStats> heaps;
+    std::vector<VulkanMemoryTypeStats> types;
+
+    std::array<VulkanMemoryUsage, static_cast<size_t>(VulkanMemoryCategory::Count)> categories{};
+
+    VulkanMemoryUsage total;
+};
+
 class VulkanMemoryAllocator
 {
     public:
@@ -22,14 +121,29 @@ class VulkanMemoryAllocator
             VulkanAllocationHandle handle
         );
 
+        // Sub-Allocated from Shared Blocks, Images and Buffers Never Share a Block
+        // Falls Back to the Next Best Memory Type when a Heap is Out of Memory
         VulkanAllocationHandle Allocate(
             const VulkanPhysicalDevice &physicalDevice,
             const VulkanDevice         &device,
-            VkDeviceSize          size,
-            uint32_t              memoryTypeBits,
-            VkMemoryPropertyFlags properties
+            const VkMemoryRequirements &requirements,
+            VkMemoryPropertyFlags properties,
+            VulkanMemoryCategory  category = VulkanMemoryCategory::Other
+        );
+
+        // Own Device Memory Object Tied to the Resource, for Resources the Driver Prefers or Requires Alone
+        VulkanAllocationHandle AllocateDedicated(
+            const VulkanPhysicalDevice    &physicalDevice,
+            const VulkanDevice            &device,
+            const VkMemoryRequirements    &requirements,
+            VkMemoryPropertyFlags         properties,
+            VulkanMemoryCategory          category,
+            const VulkanDedicatedResource &resource
         );
 
+        // UMA and Resizable BAR, Host-Visible Device-Local Memory Larger than DIRECT_WRITE_MIN_HEAP_SIZE
+        bool SupportsDirectDeviceWrites(const VulkanPhysicalDevice &physicalDevice);
+
         void* Map(
             const VulkanDevice     &device,
             VulkanAllocationHandle allocationHandle
@@ -39,6 +153,12 @@ class VulkanMemoryAllocator
             VulkanAllocationHandle allocationHandle
         );
 
+        // Makes Device Writes Visible to a Mapped Pointer, Needed for Non-Coherent Memory
+        void Invalidate(
+            const VulkanDevice     &device,
+            VulkanAllocationHandle allocationHandle
+        );
+
         void BindBuffer(
             const VulkanDevice     &device,
             VkBuffer               handle, 
@@ -50,12 +170,117 @@ class VulkanMemoryAllocator
             VulkanAllocationHandle allocationHandle
         );
 
+        // Live Device Memory Handed Out by this Allocator
+        VkDeviceSize GetAllocatedBytes()  const { return m_total.allocatedBytes; }
+        uint32_t     GetAllocationCount() const { return m_total.allocationCount; }
+
+        // Refreshes Heap Budgets and Usage, Cheap Enough to Call Every Frame
+        void UpdateBudget(const VulkanPhysicalDevice &physicalDevice, const VulkanDevice &device);
+
+        // Budgets are as of the Last UpdateBudget
+        VulkanMemoryStats GetStats() const;
+        void WriteReport(std::ostream &stream) const;
+
+        // Only Allocations with a Callback are Moved by Defragment, and Only by a Defragment of their Frame
+        void SetRelocateCallback(VulkanAllocationHandle allocationHandle, uint32_t frame, VulkanRelocateCallback callback);
+
+        // Empties the Sparsest Block of Each Pool into the Others, at Most maxBytes per Call
+        // Moves Only currentFrame's Allocations, which No Other Frame's Submit Reads or Writes
+        // Record Outside any Render Pass, Returns the Bytes Moved
+        VkDeviceSize Defragment(
+            const VulkanDevice &device,
+            VkCommandBuffer commandBuffer,
+            uint64_t        frameNumber,
+            uint32_t        currentFrame,
+            VkDeviceSize    maxBytes
+        );
+
+        // Runs once the Frame of the Last Defragment has Finished on the GPU
+        void DeferDestroy(std::function<void()> destroy);
+
+        // Frees Moved-From Allocations of Frames the GPU has Finished, UINT64_MAX after a Device Wait Frees All
+        void CollectRetired(const VulkanDevice &device, uint64_t frameNumber);
+
     private:
-        VulkanMemoryAllocator() = default;;
+        VulkanMemoryAllocator() = default;
 
-        uint32_t FindMemoryType(
-            const VulkanPhysicalDevice &physicalDevice,
-            uint32_t              typeFilter, 
-            VkMemoryPropertyFlags properties
+        struct RetiredAllocation
+        {
+            uint64_t               frameNumber = 0;
+            VulkanAllocationHandle allocation  = {};
+            std::function<void()>  destroy;
+        };
+
+        void LoadDeviceProperties(const VulkanPhysicalDevice &physicalDevice);
+
+        VulkanAllocationHandle AllocateFromTypes(
+            const VulkanPhysicalDevice    &physicalDevice,
+            const VulkanDevice            &device,
+            const VkMemoryRequirements    &requirements,
+            VkMemoryPropertyFlags         properties,
+            VulkanMemoryCategory          category,
+            const VulkanDedicatedResource *pResource
+        );
+
+        // Null when the Memory Type's Heap is Out of Memory
+        VulkanMemoryAllocation* AllocateInType(
+            const VulkanDevice            &device,
+            uint32_t                      memoryTypeIndex,
+            const VkMemoryRequirements    &requirements,
+            bool                          isOptimal,
+            const VulkanDedicatedResource *pResource
+        );
+
+        // Null on VK_ERROR_OUT_OF_DEVICE_MEMORY, Other Failures Throw
+        VulkanMemoryBlock* CreateBlock(
+            const VulkanDevice &device,
+            uint32_t     memoryTypeIndex,
+            VkDeviceSize size,
+            bool         isOptimal,
+            bool         isDedicated,
+            const VulkanDedicatedResource *pResource = nullptr
+        );
+        void FreeBlock(const VulkanDevice &device, VulkanMemoryBlock *block);
+
+        VkDeviceSize GetBlockSize(uint32_t memoryTypeIndex) const;
+
+        // Pools are Keyed by Memory Type and Whether they Hold Images
+        std::vector<std::unique_ptr<VulkanMemoryBlock>>& GetPool(uint32_t memoryTypeIndex, bool isOptimal);
+
+        // Blocks are Device Memory Objects, Allocations are the Ranges Resources Use
+        void TrackBlock(uint32_t memoryTypeIndex, VkDeviceSize size, bool isFreed);
+        void TrackAllocation(uint32_t memoryTypeIndex, VulkanMemoryCategory category, VkDeviceSize size, bool isFreed);
+
+        // Usable Types, Best First
+        std::vector<uint32_t> FindMemoryTypes(
+            uint32_t                     typeFilter,
+            const VulkanMemoryPreference &preference,
+            VkDeviceSize                 size
         ) const;
+
+        // Cached once per Physical Device
+        VkPhysicalDevice                 m_physicalDevice = VK_NULL_HANDLE;
+        VkPhysicalDeviceMemoryProperties m_memoryProperties{};
+        VkDeviceSize                     m_nonCoherentAtomSize = 1;
+
+        std::array<std::vector<std::unique_ptr<VulkanMemoryBlock>>, VK_MAX_MEMORY_TYPES * 2> m_pools;
+
+        // Every Live Allocation, Blocks Point into It and Handles Index It
+        Pool<VulkanMemoryAllocation> m_allocations;
+
+        // Copies of the Current Defragment, Kept to Reuse its Capacity
+        std::vector<VulkanBufferMove> m_moves;
+
+        // Moved-From Allocations Still Read by Frames in Flight
+        std::vector<RetiredAllocation> m_retired;
+        uint64_t                       m_frameNumber = 0;
+
+        std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> m_heapBudgets{};
+        std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> m_heapUsage{};
+        std::array<bool,         VK_MAX_MEMORY_HEAPS> m_isOverBudget{};
+
+        // Accounting
+        std::array<VulkanMemoryUsage, VK_MAX_MEMORY_TYPES> m_types{};
+        std::array<VulkanMemoryUsage, static_cast<size_t>(VulkanMemoryCategory::Count)> m_categories{};
+        VulkanMemoryUsage m_total;
 };
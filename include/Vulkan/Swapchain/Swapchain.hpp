@@ -38,30 +38,55 @@ class VulkanSwapchain
             const VulkanDevice         &device,
             uint32_t requestImageCount
         );
+
+        // Offscreen Images Stand In for the Swapchain, Nothing is Presented
+        static std::unique_ptr<VulkanSwapchain> CreateHeadless(
+            const VulkanPhysicalDevice &physicalDevice,
+            const VulkanDevice         &device,
+            VkExtent2D extent,
+            uint32_t   imageCount
+        );
         
         void CreateImages(
             const VulkanPhysicalDevice &physicalDevice,
             VulkanMemoryAllocator      &allocator
         );
         void CreateImageViews();
+        void CreateDepthResources(
+            const VulkanPhysicalDevice &physicalDevice,
+            VulkanMemoryAllocator      &allocator
+        );
         void CreateFramebuffers(const VulkanRenderPass &renderPass);
 
+        // Images are Handed Out Round Robin, One per Frame in Flight
+        uint32_t AcquireHeadlessImage(uint32_t currentFrame) const;
+
         const VkSwapchainKHR GetHandle() const { return m_handle; }
 
+        bool IsHeadless() const { return m_handle == VK_NULL_HANDLE; }
+
+        // Layout Images are Left in at the End of a Frame
+        VkImageLayout GetFinalLayout() const;
+
         // Getters
         const std::vector<std::unique_ptr<VulkanImage>>&       GetImages()       const { return m_images;       }
         const std::vector<std::unique_ptr<VulkanImageView>>&   GetImageViews()   const { return m_imageViews;   }
         const std::vector<std::unique_ptr<VulkanFramebuffer>>& GetFramebuffers() const { return m_framebuffers; }
 
-        const VkExtent2D GetExtent() const { return m_extent; }
-        const VkFormat   GetFormat() const { return m_format; }
+        const VulkanImage&     GetDepthImage()     const { return *m_depthImage;     }
+        const VulkanImageView& GetDepthImageView() const { return *m_depthImageView; }
+
+        const VkExtent2D GetExtent()      const { return m_extent; }
+        const VkFormat   GetFormat()      const { return m_format; }
+        const VkFormat   GetDepthFormat() const { return m_depthFormat; }
 
     private:
         VulkanSwapchain(
             const VulkanDevice &device,
             VkSwapchainKHR handle,
             VkExtent2D     extent,
-            VkFormat       format
+            VkFormat       format,
+            VkFormat       depthFormat
         );
 
         void Cleanup();
@@ -69,6 +94,7 @@ class VulkanSwapchain
         static VulkanSwapChainSupportDetails QuerySwapchainSupport(VkPhysicalDevice device, VkSurfaceKHR surface);
         static VkSurfaceFormatKHR ChooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR> &availableFormats);
         static VkPresentModeKHR   ChooseSwapPresentMode(const std::vector<VkPresentModeKHR> &availablePresentModes);
+        static VkFormat           ChooseDepthFormat(VkPhysicalDevice device);
         static VkExtent2D ChooseSwapExtent(const VkSurfaceCapabilitiesKHR &capabilities, int windowWidth, int windowHeight);
 
         // Remove Copying Semantics
@@ -89,7 +115,14 @@ class VulkanSwapchain
         std::vector<std::unique_ptr<VulkanImageView>>   m_imageViews;
         std::vector<std::unique_ptr<VulkanFramebuffer>> m_framebuffers;
 
+        // Depth, Shared by every Framebuffer
+        std::unique_ptr<VulkanImage>     m_depthImage;
+        std::unique_ptr<VulkanImageView> m_depthImageView;
+
         // State
         VkExtent2D m_extent{0, 0};
-        VkFormat   m_format = VK_FORMAT_UNDEFINED;
+        VkFormat   m_format      = VK_FORMAT_UNDEFINED;
+        VkFormat   m_depthFormat = VK_FORMAT_UNDEFINED;
+
+        VkImageUsageFlags m_imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
 };
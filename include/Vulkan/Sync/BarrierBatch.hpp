@@ -0,0 +1,84 @@
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+class VulkanDevice;
+class VulkanImage;
+class VulkanBuffer;
+
+// Stages and Access an Image Layout Implies on One Side of a Barrier
+struct VulkanLayoutSync
+{
+    VkPipelineStageFlags2 stages = VK_PIPELINE_STAGE_2_NONE;
+    VkAccessFlags2        access = VK_ACCESS_2_NONE;
+};
+
+// Collects Image and Buffer Barriers and Records them with One vkCmdPipelineBarrier2
+class VulkanBarrierBatch
+{
+    public:
+        // Barriers are Held in the Resource, a Frame Arena Keeps Recording Off the Heap
+        explicit VulkanBarrierBatch(
+            const VulkanDevice        &device,
+            std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+        );
+
+        // Stages and Access are Derived from the Layouts and the Image's Usage
+        VulkanBarrierBatch& AddImage(
+            const VulkanImage  &image,
+            VkImageLayout      oldLayout,
+            VkImageLayout      newLayout,
+            VkImageAspectFlags aspectMask,
+            uint32_t mipLevels   = 1,
+            uint32_t arrayLayers = 1
+        );
+        VulkanBarrierBatch& AddImage(const VkImageMemoryBarrier2 &barrier);
+
+        VulkanBarrierBatch& AddBuffer(
+            const VulkanBuffer    &buffer,
+            VkPipelineStageFlags2 srcStages,
+            VkAccessFlags2        srcAccess,
+            VkPipelineStageFlags2 dstStages,
+            VkAccessFlags2        dstAccess
+        );
+        VulkanBarrierBatch& AddBuffer(
+            VkBuffer              buffer,
+            VkDeviceSize          offset,
+            VkDeviceSize          size,
+            VkPipelineStageFlags2 srcStages,
+            VkAccessFlags2        srcAccess,
+            VkPipelineStageFlags2 dstStages,
+            VkAccessFlags2        dstAccess
+        );
+        VulkanBarrierBatch& AddBuffer(const VkBufferMemoryBarrier2 &barrier);
+
+        // Records Every Barrier Added so Far, then Empties the Batch
+        void Record(VkCommandBuffer commandBuffer);
+
+        bool IsEmpty() const { return m_imageBarriers.empty() && m_bufferBarriers.empty(); }
+
+        // Source Access is Reduced to Writes, Reads Never Need to be Made Available
+        static VulkanLayoutSync GetLayoutSync(
+            VkImageLayout     layout,
+            VkImageUsageFlags usage,
+            bool isSource
+        );
+
+        // Stages and Access a Buffer's Usage Implies When it is Read or Written Outside Transfers Too
+        static VulkanLayoutSync GetBufferSync(
+            VkBufferUsageFlags usage,
+            bool isSource
+        );
+
+    private:
+        // Devices without synchronization2 Fall Back to vkCmdPipelineBarrier
+        void RecordLegacy(VkCommandBuffer commandBuffer);
+
+        const VulkanDevice &m_device;
+
+        std::pmr::vector<VkImageMemoryBarrier2>  m_imageBarriers;
+        std::pmr::vector<VkBufferMemoryBarrier2> m_bufferBarriers;
+};
@@ -4,9 +4,12 @@
 
 #include <vulkan/vulkan.h>
 
+#include "Memory/Pool.hpp"
+
 class VulkanDevice;
 
-class VulkanFence
+// Pooled, Handles to a Fence Resolve to Null once it is Destroyed
+class VulkanFence : public Pooled<VulkanFence>
 {
     public:
         ~VulkanFence();
@@ -18,6 +21,10 @@ class VulkanFence
 
         void Wait();
 
+        // Polls without Blocking, Reset before Submitting the Fence Again
+        bool IsSignaled() const;
+        void Reset();
+
         const VkFence GetHandle() const { return m_handle; }
 
     private:
@@ -4,9 +4,12 @@
 
 #include <vulkan/vulkan.h>
 
+#include "Memory/Pool.hpp"
+
 class VulkanDevice;
 
-class VulkanSemaphore
+// Pooled, Handles to a Semaphore Resolve to Null once it is Destroyed
+class VulkanSemaphore : public Pooled<VulkanSemaphore>
 {
     public:
         ~VulkanSemaphore();
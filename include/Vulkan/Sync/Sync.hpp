@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
+#include <vulkan/vulkan.h>
+
 class VulkanDevice;
+class VulkanCommandPool;
 
 class VulkanFence;
 class VulkanSemaphore;
@@ -18,15 +22,90 @@ class VulkanSync
             uint32_t frameCount
         );
 
+        // Also Reclaims Transient Semaphores whose Frame has Retired and Uploads that have Finished
         void WaitForFence(uint32_t currentFrame);
 
+        // Per-Frame Buffers may be Rewritten Only while their Frame is Idle, Between its Fence Wait and its Submit
+        // or Before it is First Submitted, as Nothing Else Orders the Write After the GPU's Last Read
+        bool IsFrameIdle(uint32_t currentFrame) const { return m_isFrameIdle[currentFrame]; }
+
+        // Transient Objects for Uploads, Readback and Other One-Off Submissions, Reused so Steady Frames Create None
+        // Fences are Handed Out Unsignaled, Release once Waited On, which Leaves them Reset
+        VulkanFence* AcquireFence();
+        void         ReleaseFence(VulkanFence *fence);
+
+        // Unsignaled Binary Semaphores, Reclaimed once the Frame they were Released in has Finished
+        // so any Wait on them must be Submitted No Later than that Frame
+        VulkanSemaphore* AcquireSemaphore();
+        void             ReleaseSemaphore(VulkanSemaphore *semaphore);
+
+        // One-Off Command Buffers, Recycled from Finished Uploads of the Same Pool
+        VkCommandBuffer AcquireCommandBuffer(const VulkanCommandPool &commandPool);
+
+        // Keeps a Submitted Upload's Command Buffer and Fence Until the Fence Signals, Nothing Waits Inline
+        // Returns a Ticket for WaitForUpload, Held by Whatever Must Not be Rewritten Before the Copy Reads It
+        uint64_t TrackUpload(const VulkanCommandPool &commandPool, VkCommandBuffer commandBuffer, VulkanFence *fence);
+
+        // Blocks Only if the Upload is Still Running, Frame-Paced Reuse Finds it Long Done
+        void WaitForUpload(uint64_t upload);
+
+        // Reclaims Finished Uploads, or Waits for All of Them; Call While the Command Pools Still Exist
+        void CollectUploads(bool waitAll);
+
+        uint32_t GetPendingUploadCount() const { return static_cast<uint32_t>(m_pendingUploads.size()); }
+
+        // Waited On by the Frame's Next Submit, a Pooled Semaphore is Released once that Submit is Made
+        void AddFrameWait(uint32_t currentFrame, VkSemaphore semaphore, VkPipelineStageFlags stage);
+        void AddFrameWait(uint32_t currentFrame, VulkanSemaphore *semaphore, VkPipelineStageFlags stage);
+
+        // Arrays are Reused, Submitting Never Touches the Heap once they have Grown
+        uint32_t                    GetFrameWaitCount(uint32_t currentFrame)      const { return static_cast<uint32_t>(m_frameWaits[currentFrame].semaphores.size()); }
+        const VkSemaphore*          GetFrameWaitSemaphores(uint32_t currentFrame) const { return m_frameWaits[currentFrame].semaphores.data(); }
+        const VkPipelineStageFlags* GetFrameWaitStages(uint32_t currentFrame)     const { return m_frameWaits[currentFrame].stages.data(); }
+
+        // Call after the Frame Submit, Releases the Waits it Consumed and Marks the Frame Busy
+        void MarkFrameSubmitted(uint32_t currentFrame);
+
+        // Transient Objects Created so Far, Flat once the Pool has Warmed Up
+        uint32_t GetTransientFenceCount()     const { return static_cast<uint32_t>(m_fences.size()); }
+        uint32_t GetTransientSemaphoreCount() const { return static_cast<uint32_t>(m_semaphores.size()); }
+
         // Getters
         const std::vector<std::unique_ptr<VulkanFence>>&     GetInFlightFences()   const { return m_inFlightFences;   }
         const std::vector<std::unique_ptr<VulkanSemaphore>>& GetImageSemaphores()  const { return m_imageSemaphores;  }
         const std::vector<std::unique_ptr<VulkanSemaphore>>& GetRenderSemaphores() const { return m_renderSemaphores; }
 
     private:
+        struct RetiringSemaphore
+        {
+            uint64_t         frameNumber = 0;
+            VulkanSemaphore *semaphore   = nullptr;
+        };
+
+        struct PendingUpload
+        {
+            uint64_t        upload        = 0;
+            VkCommandPool   commandPool   = VK_NULL_HANDLE;
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+            VulkanFence    *fence         = nullptr;
+        };
+
+        struct FreeCommandBuffer
+        {
+            VkCommandPool   commandPool   = VK_NULL_HANDLE;
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        };
+
+        // Uploads Wait on Different Frames, so Each Frame Keeps its Own Waits
+        struct FrameWaits
+        {
+            std::vector<VkSemaphore>          semaphores;
+            std::vector<VkPipelineStageFlags> stages;
+            std::vector<VulkanSemaphore*>     pooled;
+        };
+
         VulkanSync(
+            const VulkanDevice &device,
             std::vector<std::unique_ptr<VulkanFence>>     inFlightFences,
             std::vector<std::unique_ptr<VulkanSemaphore>> imageSemaphores,
             std::vector<std::unique_ptr<VulkanSemaphore>> renderSemaphores
@@ -34,6 +113,9 @@ class VulkanSync
 
         void Cleanup();
 
+        // The Fence must be Reset, the Command Buffer is Reset when Next Begun
+        void ReclaimUpload(const PendingUpload &upload);
+
         // Remove Copying Semantics
         VulkanSync(const VulkanSync&) = delete;
         VulkanSync& operator=(const VulkanSync&) = delete;
@@ -42,8 +124,31 @@ class VulkanSync
         VulkanSync(VulkanSync &&other) noexcept;
         VulkanSync& operator=(VulkanSync &&other) noexcept;
 
+        const VulkanDevice &m_device;
+
         // Objects
         std::vector<std::unique_ptr<VulkanFence>>     m_inFlightFences;
         std::vector<std::unique_ptr<VulkanSemaphore>> m_imageSemaphores;
         std::vector<std::unique_ptr<VulkanSemaphore>> m_renderSemaphores;
+
+        // Cleared by the Frame's Submit, Set Again by its Fence Wait
+        std::vector<bool> m_isFrameIdle;
+
+        // Transient Pools, Owned Here and Lent Out by Pointer
+        std::vector<std::unique_ptr<VulkanFence>>     m_fences;
+        std::vector<std::unique_ptr<VulkanSemaphore>> m_semaphores;
+        std::vector<VulkanFence*>                     m_freeFences;
+        std::vector<VulkanSemaphore*>                 m_freeSemaphores;
+        std::vector<RetiringSemaphore>                m_retiringSemaphores;
+
+        // Uploads in Flight and Command Buffers of Finished Ones, Freed with their Pools
+        std::vector<PendingUpload>     m_pendingUploads;
+        std::vector<FreeCommandBuffer> m_freeCommandBuffers;
+        uint64_t                       m_nextUpload = 1;
+
+        // Waits for Each Frame's Next Submit
+        std::vector<FrameWaits> m_frameWaits;
+
+        // Frames Begun, Counted by WaitForFence
+        uint64_t m_frameNumber = 0;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include <GLFW/glfw3.h>
 #include <vulkan/vulkan.h>
@@ -16,7 +17,15 @@ class App
     public:
         ~App();
 
-        static App Create();
+        // Headless Apps Render Offscreen for a Fixed Number of Frames without a Window
+        // A Trace Path Captures the First TRACE_CAPTURE_FRAMES Frames, Needs ENGINE_PROFILING
+        // A Memory Report Path Writes the Allocator's JSON Report on Exit
+        static App Create(
+            bool               headless           = false,
+            bool               pipelineStatistics = false,
+            const std::string &tracePath          = "",
+            const std::string &memoryReportPath   = ""
+        );
 
         void Run();
 
@@ -24,10 +33,25 @@ class App
         App(
             std::unique_ptr<Window>         window,
             std::unique_ptr<VulkanRenderer> renderer,
-            std::shared_ptr<VulkanScene>    scene
+            std::shared_ptr<VulkanScene>    scene,
+            std::string                     tracePath,
+            std::string                     memoryReportPath
         );
 
+        bool ShouldClose(uint64_t frameNumber) const;
+
+        // GPU Timings and Pipeline Statistics of the Last Collected Frames
+        void LogFrameReport() const;
+
+        void WriteTrace() const;
+        void WriteMemoryReport() const;
+
+        // Null when Headless
         std::unique_ptr<Window>         m_window;
         std::unique_ptr<VulkanRenderer> m_renderer;
         std::shared_ptr<VulkanScene>    m_scene;
+
+        // Empty when Not Written
+        std::string m_tracePath;
+        std::string m_memoryReportPath;
 };
@@ -10,9 +10,59 @@ constexpr uint32_t FRAMES_IN_FLIGHT = 2;
 constexpr double TARGET_FPS = 120.0;
 constexpr double FRAME_TIME = 1.0 / TARGET_FPS;
 
+// Records Passes with vkCmdBeginRendering when the Device Supports It
+constexpr bool USE_DYNAMIC_RENDERING = true;
+
+// Samples per Pixel on the Main Pass, Clamped to the Device, 1 Disables MSAA
+constexpr uint32_t MSAA_SAMPLES = 4;
+
+// Frames Rendered Offscreen before a Headless Run Exits
+constexpr uint64_t HEADLESS_FRAME_COUNT = 300;
+
+// Timestamps Around Frames and Render Graph Passes, Rolling Stats Cover the Last Samples
+constexpr bool   ENABLE_GPU_PROFILER  = true;
+constexpr size_t GPU_PROFILER_HISTORY = 128;
+
+// CPU Zones Each Thread can Hold Between Flushes, a Power of Two
+constexpr size_t CPU_PROFILER_RING_SIZE = 16384;
+
+// Frames Written to the Chrome Trace Given by --trace
+constexpr uint64_t TRACE_CAPTURE_FRAMES = 120;
+
+// Transient Host Memory per Frame in Flight, Frames that Need More Fall Back to the Heap
+constexpr size_t FRAME_ARENA_SIZE = 256 * 1024;
+
+// Shared Device Memory Blocks, Small Heaps Use an Eighth of their Size
+constexpr uint64_t MEMORY_BLOCK_SIZE = 64ull * 1024 * 1024;
+
+// Bytes Defragmentation may Copy Each Frame, 0 Disables It
+constexpr uint64_t DEFRAG_BYTES_PER_FRAME = 4ull * 1024 * 1024;
+
+// Dynamic Vertex and Index Data is Written Straight into Device-Local Memory on UMA and Resizable BAR
+// Host-Visible Device-Local Heaps No Larger than the Minimum are the Classic 256 MiB BAR Window
+constexpr bool     ENABLE_DIRECT_DEVICE_WRITES = true;
+constexpr uint64_t DIRECT_WRITE_MIN_HEAP_SIZE  = 256ull * 1024 * 1024;
+
+// Uploads Go to a Transfer-Only Queue Family when the Device has One, the Copy Engine Runs Beside Rendering
+constexpr bool ENABLE_TRANSFER_QUEUE = true;
+
+// Typed Object Pools Grow in Chunks that Never Move, up to POOL_CHUNK_SIZE * POOL_MAX_CHUNKS Objects per Type
+constexpr uint32_t POOL_CHUNK_SIZE = 256;
+constexpr uint32_t POOL_MAX_CHUNKS = 1024;
+
 inline std::string SCREEN_NAME = "Vulkan Engine";
 inline std::string ENGINE_NAME = "Vulkan Engine";
 
+// Shaders
+inline std::string SHADER_DIRECTORY    = "assets/shaders";
+inline std::string PIPELINE_CACHE_PATH = "pipeline.cache";
+
+#ifdef NDEBUG
+constexpr bool SHADER_HOT_RELOAD = false;
+#else
+constexpr bool SHADER_HOT_RELOAD = true;
+#endif
+
 // Camera
 constexpr float CAMERA_FOV  = 76.0f;
 constexpr float CAMERA_NEAR = 0.1f;
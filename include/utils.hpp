@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <stdexcept>
 #include <string>
@@ -7,3 +9,6 @@
 
 std::string       readFile(const std::string &filePath);
 std::vector<char> readFileBinary(const std::string &filePath);
+
+void     hashCombine(size_t &seed, size_t value);
+uint64_t hashBytes(const void *data, size_t size);
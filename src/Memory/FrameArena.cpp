@@ -0,0 +1,62 @@
+#include "Memory/FrameArena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+
+FrameArena::FrameArena(std::unique_ptr<std::byte[]> buffer, size_t capacity) :
+    m_buffer(std::move(buffer)),
+    m_capacity(capacity),
+    m_overflow(std::pmr::new_delete_resource())
+{}
+
+std::unique_ptr<FrameArena> FrameArena::Create(size_t capacity)
+{
+    return std::unique_ptr<FrameArena>(
+        new FrameArena(
+            std::make_unique<std::byte[]>(capacity),
+            capacity
+        )
+    );
+}
+
+void FrameArena::Reset()
+{
+    m_offset = 0;
+
+    if (m_overflowBytes > 0)
+    {
+        m_overflow.release();
+        m_overflowBytes = 0;
+    }
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment)
+{
+    uintptr_t base    = reinterpret_cast<uintptr_t>(m_buffer.get());
+    uintptr_t aligned = (base + m_offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    size_t    offset  = static_cast<size_t>(aligned - base);
+
+    if (offset + bytes <= m_capacity)
+    {
+        m_offset    = offset + bytes;
+        m_peakBytes = std::max(m_peakBytes, m_offset);
+
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    // Still Correct, but Every Overflow is a Heap Allocation
+    if (!m_hasWarned)
+    {
+        std::cerr << "[WARNING]\tFrame Arena of " << m_capacity << " Bytes Overflowed, Raise FRAME_ARENA_SIZE.\n";
+        m_hasWarned = true;
+    }
+
+    m_overflowBytes += bytes;
+    return m_overflow.allocate(bytes, alignment);
+}
+
+void FrameArena::do_deallocate(void*, size_t, size_t)
+{
+    // Memory is Only Returned by Reset
+}
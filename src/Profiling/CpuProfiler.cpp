@@ -0,0 +1,223 @@
+#include "Profiling/CpuProfiler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+#include "Settings.hpp"
+
+static_assert((CPU_PROFILER_RING_SIZE & (CPU_PROFILER_RING_SIZE - 1)) == 0, "CPU_PROFILER_RING_SIZE must be a Power of Two.");
+
+namespace
+{
+    // Single Producer, the Owning Thread, and Single Consumer, Flush Under the State Mutex
+    struct ThreadRing
+    {
+        uint32_t track = 0;
+
+        std::vector<CpuProfileEvent> events = std::vector<CpuProfileEvent>(CPU_PROFILER_RING_SIZE);
+
+        std::atomic<uint64_t> head    = 0;
+        std::atomic<uint64_t> tail    = 0;
+        std::atomic<uint64_t> dropped = 0;
+    };
+
+    struct ProfilerState
+    {
+        std::mutex mutex;
+
+        // Rings Outlive their Threads so Late Zones are Still Flushed
+        std::vector<std::shared_ptr<ThreadRing>> rings;
+        std::vector<CpuProfileEvent>             capture;
+        std::unordered_set<std::string>          names;
+
+        std::atomic<bool> isCapturing = false;
+    };
+
+    ProfilerState& getState()
+    {
+        static ProfilerState state;
+        return state;
+    }
+
+    ThreadRing& getThreadRing()
+    {
+        thread_local std::shared_ptr<ThreadRing> ring = [] {
+            ProfilerState &state = getState();
+            std::lock_guard<std::mutex> lock(state.mutex);
+
+            auto created   = std::make_shared<ThreadRing>();
+            created->track = static_cast<uint32_t>(state.rings.size());
+
+            state.rings.push_back(created);
+            return created;
+        }();
+
+        return *ring;
+    }
+
+    void pushEvent(ThreadRing &ring, const CpuProfileEvent &event)
+    {
+        uint64_t head = ring.head.load(std::memory_order_relaxed);
+
+        // Full Rings Drop the Newest Zone Rather than Block
+        if (head - ring.tail.load(std::memory_order_acquire) >= CPU_PROFILER_RING_SIZE)
+        {
+            ring.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        ring.events[head & (CPU_PROFILER_RING_SIZE - 1)] = event;
+        ring.head.store(head + 1, std::memory_order_release);
+    }
+
+    void writeEscaped(std::ostream &stream, const char *text)
+    {
+        for (; *text; ++text)
+        {
+            if (*text == '"' || *text == '\\')
+                stream << '\\';
+
+            stream << *text;
+        }
+    }
+}
+
+uint64_t CpuProfiler::Now()
+{
+    using Clock = std::chrono::steady_clock;
+
+    static const Clock::time_point epoch = Clock::now();
+
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch).count());
+}
+
+void CpuProfiler::BeginCapture()
+{
+    ProfilerState &state = getState();
+
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        state.capture.clear();
+
+        // Zones Closed Before the Capture Began are Discarded
+        for (auto &ring : state.rings)
+        {
+            ring->tail.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+            ring->dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    state.isCapturing.store(true, std::memory_order_release);
+}
+
+std::vector<CpuProfileEvent> CpuProfiler::EndCapture()
+{
+    ProfilerState &state = getState();
+    state.isCapturing.store(false, std::memory_order_release);
+
+    Flush();
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    uint64_t dropped = 0;
+    for (auto &ring : state.rings)
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+
+    if (dropped > 0)
+        std::cerr << "[WARNING]\tCPU Profiler Dropped " << dropped << " Zones, Flush More Often or Raise CPU_PROFILER_RING_SIZE.\n";
+
+    return std::move(state.capture);
+}
+
+bool CpuProfiler::IsCapturing()
+{
+    return getState().isCapturing.load(std::memory_order_relaxed);
+}
+
+void CpuProfiler::Flush()
+{
+    ProfilerState &state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    for (auto &ring : state.rings)
+    {
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+
+        for (uint64_t i = tail; i < head; ++i)
+            state.capture.push_back(ring->events[i & (CPU_PROFILER_RING_SIZE - 1)]);
+
+        ring->tail.store(head, std::memory_order_release);
+    }
+}
+
+void CpuProfiler::Record(const char *name, uint64_t start, uint64_t end, uint32_t track)
+{
+    if (!IsCapturing())
+        return;
+
+    pushEvent(getThreadRing(), { name, start, end, track });
+}
+
+const char* CpuProfiler::Intern(const std::string &name)
+{
+    ProfilerState &state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    // Set Nodes Never Move, so the Pointer Outlives Rehashing
+    return state.names.insert(name).first->c_str();
+}
+
+void CpuProfiler::WriteChromeTrace(std::ostream &stream, const std::vector<CpuProfileEvent> &events)
+{
+    std::unordered_set<uint32_t> tracks;
+
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\n";
+    stream << "  \"displayTimeUnit\": \"ns\",\n";
+    stream << "  \"traceEvents\": [\n";
+
+    // Complete Events, Microsecond Timestamps
+    for (const auto &event : events)
+    {
+        tracks.insert(event.track);
+
+        stream << "    { \"name\": \"";
+        writeEscaped(stream, event.name);
+        stream << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << event.track
+               << ", \"ts\": "  << static_cast<double>(event.start) * 1.0e-3
+               << ", \"dur\": " << static_cast<double>(event.end - event.start) * 1.0e-3
+               << " },\n";
+    }
+
+    // Track Names, the GPU Sorted Below the Threads
+    size_t remaining = tracks.size();
+    for (uint32_t track : tracks)
+    {
+        bool isGpu = track == PROFILE_TRACK_GPU;
+
+        stream << "    { \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << track
+               << ", \"args\": { \"name\": \"" << (isGpu ? "GPU" : "Thread " + std::to_string(track)) << "\" } },\n";
+        stream << "    { \"name\": \"thread_sort_index\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << track
+               << ", \"args\": { \"sort_index\": " << (isGpu ? UINT32_MAX : track) << " } }"
+               << (--remaining > 0 ? ",\n" : "\n");
+    }
+
+    stream << "  ]\n";
+    stream << "}\n";
+}
+
+CpuProfileZone::~CpuProfileZone()
+{
+    if (!CpuProfiler::IsCapturing())
+        return;
+
+    ThreadRing &ring = getThreadRing();
+    pushEvent(ring, { m_name, m_start, CpuProfiler::Now(), ring.track });
+}
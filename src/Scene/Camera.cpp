@@ -1,5 +1,7 @@
 #include "Scene/Camera.hpp"
 
+#include <cmath>
+
 #include "Window/Window.hpp"
 
 #include "Vulkan/Buffers/Uniform.hpp"
@@ -107,13 +109,18 @@ void Camera::Rotate(
 	}
 }
 
-glm::mat4x4 Camera::GetProjMatrix(const Window &window)
+glm::mat4x4 Camera::GetProjMatrix(float aspectRatio)
 {
-    int width, height;
-    glfwGetFramebufferSize(window.GetHandle(), &width, &height);
-    float aspectRatio = static_cast<float>(width) / static_cast<float>(height);
-    
-    return glm::perspective(m_fov, aspectRatio, m_near, m_far);
+    // Reverse-Z with an Infinite Far Plane, Depth is 1 at the Near Plane and 0 at Infinity
+    float focalLength = 1.0f / std::tan(m_fov * 0.5f);
+
+    glm::mat4x4 projection(0.0f);
+    projection[0][0] = focalLength / aspectRatio;
+    projection[1][1] = focalLength;
+    projection[2][3] = -1.0f;
+    projection[3][2] = m_near;
+
+    return projection;
 }
 
 glm::mat4x4 Camera::GetViewMatrix()
@@ -138,10 +145,10 @@ void Camera::UpdateVectors()
 }
 
 void Camera::UpdateBuffer(
-    const Window &window,
+    float    aspectRatio,
     uint32_t currentFrame
 ) {
-    m_bufferData.cameraMatrix = GetProjMatrix(window) * GetViewMatrix();
+    m_bufferData.cameraMatrix = GetProjMatrix(aspectRatio) * GetViewMatrix();
     m_buffer->Update(&m_bufferData, currentFrame);
 }
 
@@ -57,24 +57,41 @@ void VulkanMesh::Bind(
 
 void VulkanMesh::UpdateBuffers(
     const VulkanCommandPool &commandPool,
+    VulkanSync              &sync,
     const std::vector<Vertex>   &vertices,
     const std::vector<uint32_t> &indices,
     uint32_t currentFrame
 ) {
-    m_vertexBuffer->Update(commandPool, (void*)vertices.data(), currentFrame);
-    m_indexBuffer->Update(commandPool, (void*)indices.data(), currentFrame);
+    m_vertexBuffer->Update(commandPool, sync, (void*)vertices.data(), currentFrame);
+    m_indexBuffer->Update(commandPool, sync, (void*)indices.data(), currentFrame);
+
+    if (vertices.empty())
+        return;
+
+    // Bounds for Depth Sorting
+    glm::vec3 boundsMin = vertices[0].pos;
+    glm::vec3 boundsMax = vertices[0].pos;
+    for (const auto &vertex : vertices)
+    {
+        boundsMin = glm::min(boundsMin, vertex.pos);
+        boundsMax = glm::max(boundsMax, vertex.pos);
+    }
+
+    m_center = (boundsMin + boundsMax) * 0.5f;
 }
 
 void VulkanMesh::Draw(VkCommandBuffer vkCommandBuffer)
 {
-    vkCmdDrawIndexed(vkCommandBuffer, m_indexCount, 1, 0, 0, 0);
+    vkCmdDrawIndexed(vkCommandBuffer, m_indexCount, m_instanceCount, 0, 0, 0);
 }
 
 VulkanMesh::VulkanMesh(VulkanMesh&& other) noexcept : 
     m_vertexBuffer(std::move(other.m_vertexBuffer)),
     m_indexBuffer(std::move(other.m_indexBuffer)),
     m_vertexCount(other.m_vertexCount),
-    m_indexCount(other.m_indexCount)
+    m_indexCount(other.m_indexCount),
+    m_instanceCount(other.m_instanceCount),
+    m_center(other.m_center)
 {
     other = VulkanMesh{};
 }
@@ -87,6 +104,8 @@ VulkanMesh& VulkanMesh::operator=(VulkanMesh &&other) noexcept
         m_indexBuffer  = std::move(other.m_indexBuffer);
         m_vertexCount = other.m_vertexCount;
         m_indexCount  = other.m_indexCount;
+        m_instanceCount = other.m_instanceCount;
+        m_center      = other.m_center;
 
         other = VulkanMesh{};
     }
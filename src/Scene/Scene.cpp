@@ -3,6 +3,8 @@
 #include "Scene/Camera.hpp"
 #include "Scene/Mesh.hpp"
 
+#include "Profiling/CpuProfiler.hpp"
+
 VulkanScene::VulkanScene(
     std::unique_ptr<Camera> camera,
     std::vector<std::vector<VkDescriptorSet>> descriptorSets,
@@ -66,13 +68,19 @@ void VulkanScene::Cleanup()
 }
 
 void VulkanScene::Update(
-    const Window &window,
+    const Window *window,
+    VkExtent2D   extent,
     double   deltaTime,
     uint32_t currentFrame
 ) {
+    PROFILE_ZONE("Scene::Update");
+
     // Update Camera
-    m_camera->Update(window, deltaTime);
-    m_camera->UpdateBuffer(window, currentFrame);
+    if (window)
+        m_camera->Update(*window, deltaTime);
+
+    float aspectRatio = static_cast<float>(extent.width) / static_cast<float>(extent.height);
+    m_camera->UpdateBuffer(aspectRatio, currentFrame);
 }
 
 VulkanScene::VulkanScene(VulkanScene&& other) noexcept : 
@@ -1,6 +1,7 @@
 #include "Vulkan/Buffers/Staging.hpp"
 
 #include "Vulkan/Resources/Buffer.hpp"
+#include "Vulkan/Sync/Sync.hpp"
 
 VulkanStagingBuffer::VulkanStagingBuffer(
     std::unique_ptr<VulkanBuffer> buffer,
@@ -24,7 +25,8 @@ std::unique_ptr<VulkanStagingBuffer> VulkanStagingBuffer::Create(
         allocator,
         size,
         VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        VulkanMemoryCategory::Staging
     );
 
     return std::unique_ptr<VulkanStagingBuffer>(
@@ -35,21 +37,26 @@ std::unique_ptr<VulkanStagingBuffer> VulkanStagingBuffer::Create(
     );
 }
 
-void VulkanStagingBuffer::Update(void *data)
+void VulkanStagingBuffer::Update(VulkanSync &sync, void *data)
 {
+    sync.WaitForUpload(m_upload);
+
     m_buffer->Update(data, m_size);
 }
 
 void VulkanStagingBuffer::CopyTo(
     const VulkanCommandPool &commandPool,
-    const VulkanBuffer      &dst
+    VulkanSync              &sync,
+    const VulkanBuffer      &dst,
+    uint32_t                currentFrame
 ) {
-    m_buffer->CopyTo(commandPool, dst);
+    m_upload = m_buffer->CopyTo(commandPool, sync, dst, currentFrame);
 }
 
 VulkanStagingBuffer::VulkanStagingBuffer(VulkanStagingBuffer&& other) noexcept : 
     m_size(other.m_size),
-    m_buffer(std::move(other.m_buffer))
+    m_buffer(std::move(other.m_buffer)),
+    m_upload(other.m_upload)
 {
     other = VulkanStagingBuffer{};
 }
@@ -60,6 +67,7 @@ VulkanStagingBuffer& VulkanStagingBuffer::operator=(VulkanStagingBuffer &&other)
     {
         m_size   = other.m_size;
         m_buffer = std::move(other.m_buffer);
+        m_upload = other.m_upload;
 
         other = VulkanStagingBuffer{};
     }
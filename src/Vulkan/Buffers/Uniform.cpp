@@ -5,6 +5,7 @@
 
 #include "Vulkan/Core/Device.hpp"
 #include "Vulkan/Descriptors/DescriptorPool.hpp"
+#include "Vulkan/Descriptors/LayoutCache.hpp"
 #include "Vulkan/Pipeline/Pipeline.hpp"
 
 #include "Vulkan/Resources/Buffer.hpp"
@@ -50,31 +51,19 @@ std::unique_ptr<VulkanUniformBuffer> VulkanUniformBuffer::Create(
             allocator,
             size,
             VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            VulkanMemoryCategory::Uniform
         ));
     }
 
-    // Create Descriptor Set Layout
+    // Descriptor Set Layout
     VkDescriptorSetLayoutBinding bufferLayout{};
     bufferLayout.binding         = 0;
     bufferLayout.descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
     bufferLayout.descriptorCount = 1;
     bufferLayout.stageFlags      = VK_SHADER_STAGE_ALL;
 
-    VkDescriptorSetLayoutCreateInfo layoutInfo{};
-    layoutInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    layoutInfo.bindingCount = 1;
-    layoutInfo.pBindings    = &bufferLayout;
-
-    // Create Descriptor Layout
-    VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
-    result = vkCreateDescriptorSetLayout(device.GetHandle(), &layoutInfo, nullptr, &descriptorSetLayout);
-    if (result != VK_SUCCESS)
-    {
-        std::cerr << "[ERROR]\t'vkCreateDescriptorSetLayout' Failed with Error Code " << result << "\n";
-
-        throw std::runtime_error("Failed to Create Descriptor Set Layout.");
-    }
+    VkDescriptorSetLayout descriptorSetLayout = device.GetLayoutCache().GetDescriptorSetLayout({ bufferLayout });
 
     // Allocate Descriptor Sets
     std::vector<VkDescriptorSet>       descriptorSets(count);
@@ -129,11 +118,8 @@ void VulkanUniformBuffer::Cleanup()
 {
     m_buffers.clear();
     
-    if (m_descriptorSetLayout != VK_NULL_HANDLE)
-    {
-        vkDestroyDescriptorSetLayout(m_device.GetHandle(), m_descriptorSetLayout, nullptr);
-        m_descriptorSetLayout = VK_NULL_HANDLE;
-    }
+    // Descriptor Set Layout is Owned by the Layout Cache
+    m_descriptorSetLayout = VK_NULL_HANDLE;
 }
 
 void VulkanUniformBuffer::Bind(
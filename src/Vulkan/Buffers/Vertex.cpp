@@ -1,7 +1,13 @@
 #include "Vulkan/Buffers/Vertex.hpp"
 
+#include <stdexcept>
+
 #include "Vulkan/Resources/Buffer.hpp"
+#include "Vulkan/Resources/MemoryAllocator.hpp"
 #include "Vulkan/Buffers/Staging.hpp"
+#include "Vulkan/Sync/Sync.hpp"
+
+#include "Settings.hpp"
 
 VulkanVertexBuffer::VulkanVertexBuffer(
     std::vector<std::unique_ptr<VulkanBuffer>>        buffers,
@@ -23,6 +29,16 @@ std::unique_ptr<VulkanVertexBuffer> VulkanVertexBuffer::Create(
     VkDeviceSize size,
     uint32_t     count
 ) {
+    // Written in Place when the Host can Reach Large Device-Local Memory, Through Staging Otherwise
+    bool isDirect = ENABLE_DIRECT_DEVICE_WRITES && allocator.SupportsDirectDeviceWrites(physicalDevice);
+
+    VkBufferUsageFlags    usage      = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    VkMemoryPropertyFlags properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    if (isDirect)
+        properties |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    else
+        usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
     // Initialize Vertex Buffers
     std::vector<std::unique_ptr<VulkanBuffer>> buffers;
 
@@ -34,8 +50,10 @@ std::unique_ptr<VulkanVertexBuffer> VulkanVertexBuffer::Create(
                 device,
                 allocator,
                 size,
-                VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+                usage,
+                properties,
+                VulkanMemoryCategory::Mesh,
+                i
             )
         );
     }
@@ -43,7 +61,7 @@ std::unique_ptr<VulkanVertexBuffer> VulkanVertexBuffer::Create(
     // Initialize Staging Buffers
     std::vector<std::unique_ptr<VulkanStagingBuffer>> stagingBuffers;
 
-    for (uint32_t i = 0; i < count; ++i)
+    for (uint32_t i = 0; i < count && !isDirect; ++i)
     {
         stagingBuffers.emplace_back(
             VulkanStagingBuffer::Create(
@@ -89,11 +107,22 @@ void VulkanVertexBuffer::Bind(
 
 void VulkanVertexBuffer::Update(
     const VulkanCommandPool &commandPool,
+    VulkanSync              &sync,
     void     *data,
     uint32_t currentFrame
 ) {
-    m_stagingBuffers[currentFrame]->Update(data);
-    m_stagingBuffers[currentFrame]->CopyTo(commandPool, *m_buffers[currentFrame]);
+    if (!sync.IsFrameIdle(currentFrame))
+        throw std::runtime_error("Vertex Buffer Updated while its Frame is in Flight, Update after the Frame's Fence Wait.");
+
+    // Without Staging Buffers the Write Lands in Device-Local Memory, No Transfer is Submitted
+    if (m_stagingBuffers.empty())
+    {
+        m_buffers[currentFrame]->Update(data, m_size);
+        return;
+    }
+
+    m_stagingBuffers[currentFrame]->Update(sync, data);
+    m_stagingBuffers[currentFrame]->CopyTo(commandPool, sync, *m_buffers[currentFrame], currentFrame);
 }
 
 VulkanVertexBuffer::VulkanVertexBuffer(VulkanVertexBuffer&& other) noexcept : 
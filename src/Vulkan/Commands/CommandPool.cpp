@@ -7,9 +7,11 @@
 
 VulkanCommandPool::VulkanCommandPool(
     const VulkanDevice &device,
-    VkCommandPool handle
+    VkCommandPool handle,
+    uint32_t      queueFamily
 ) : m_device(device),
-    m_handle(handle)
+    m_handle(handle),
+    m_queueFamily(queueFamily)
 {}
 
 VulkanCommandPool::~VulkanCommandPool()
@@ -18,13 +20,14 @@ VulkanCommandPool::~VulkanCommandPool()
 }
 
 std::unique_ptr<VulkanCommandPool> VulkanCommandPool::Create(
-    const VulkanDevice &device
+    const VulkanDevice &device,
+    uint32_t queueFamily
 ) {
     VkResult result = VK_SUCCESS;
 
     VkCommandPoolCreateInfo poolInfo{};
     poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    poolInfo.queueFamilyIndex = device.GetGraphicsQueueFamily();
+    poolInfo.queueFamilyIndex = queueFamily;
     poolInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
 
     // Create Command Pool
@@ -42,7 +45,8 @@ std::unique_ptr<VulkanCommandPool> VulkanCommandPool::Create(
     return std::unique_ptr<VulkanCommandPool>(
         new VulkanCommandPool(
             device,
-            handle
+            handle,
+            queueFamily
         )
     );
 }
@@ -115,6 +119,7 @@ VkCommandBuffer VulkanCommandPool::BeginFrame(uint32_t currentFrame)
 VulkanCommandPool::VulkanCommandPool(VulkanCommandPool &&other) noexcept : 
     m_device(other.m_device),
     m_handle(other.m_handle),
+    m_queueFamily(other.m_queueFamily),
     m_commandBuffers(std::move(other.m_commandBuffers))
 {
     other.m_handle = VK_NULL_HANDLE;
@@ -128,6 +133,7 @@ VulkanCommandPool& VulkanCommandPool::operator=(VulkanCommandPool &&other) noexc
         Cleanup();
         
         m_handle         = other.m_handle;
+        m_queueFamily    = other.m_queueFamily;
         m_commandBuffers = std::move(other.m_commandBuffers);
 
         other.m_handle = VK_NULL_HANDLE;
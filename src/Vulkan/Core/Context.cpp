@@ -24,23 +24,31 @@ VulkanContext::VulkanContext(
 VulkanContext::~VulkanContext() = default;
 
 std::unique_ptr<VulkanContext> VulkanContext::Create(
-    const Window &window,
+    const Window *window,
     uint32_t frameCount
 ) {
+    // Without a Window Nothing is Presented, so there is No Surface
+    bool headless = window == nullptr;
+
     auto instance = VulkanInstance::Create(
         SCREEN_NAME,
         VK_MAKE_VERSION(1, 0, 0),
         ENGINE_NAME,
-        VK_MAKE_VERSION(1, 0, 0)
+        VK_MAKE_VERSION(1, 0, 0),
+        headless
     );
 
-    auto debug = VulkanDebug::Create(*instance);
+    std::unique_ptr<VulkanDebug> debug;
+    if (instance->IsDebugUtilsEnabled())
+        debug = VulkanDebug::Create(*instance);
 
-    auto surface = VulkanSurface::Create(window, *instance);
+    std::unique_ptr<VulkanSurface> surface;
+    if (!headless)
+        surface = VulkanSurface::Create(*window, *instance);
 
-    auto physicalDevice = VulkanPhysicalDevice::Create(*instance, *surface);
+    auto physicalDevice = VulkanPhysicalDevice::Create(*instance, surface.get());
 
-    auto device = VulkanDevice::Create(*physicalDevice);
+    auto device = VulkanDevice::Create(*physicalDevice, !headless);
 
     return std::unique_ptr<VulkanContext>(
         new VulkanContext(
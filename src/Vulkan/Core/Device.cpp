@@ -1,22 +1,46 @@
 #include "Vulkan/Core/Device.hpp"
 
+#include <cstring>
 #include <iostream>
 #include <set>
 #include <vector>
 
 #include "Vulkan/Core/PhysicalDevice.hpp"
+#include "Vulkan/Descriptors/LayoutCache.hpp"
+#include "Vulkan/Pipeline/ShaderModuleCache.hpp"
+
+static bool IsExtensionSupported(VkPhysicalDevice vkPhysicalDevice, const char *extensionName)
+{
+    uint32_t extensionCount = 0;
+    vkEnumerateDeviceExtensionProperties(vkPhysicalDevice, nullptr, &extensionCount, nullptr);
+
+    std::vector<VkExtensionProperties> extensions(extensionCount);
+    vkEnumerateDeviceExtensionProperties(vkPhysicalDevice, nullptr, &extensionCount, extensions.data());
+
+    for (const auto &extension : extensions)
+    {
+        if (std::strcmp(extension.extensionName, extensionName) == 0)
+            return true;
+    }
+
+    return false;
+}
 
 VulkanDevice::VulkanDevice(
     VkDevice handle,
     VkQueue  graphicsQueue,
     VkQueue  presentQueue,
+    VkQueue  transferQueue,
     uint32_t graphicsQueueFamily,
-    uint32_t presentQueueFamily
+    uint32_t presentQueueFamily,
+    uint32_t transferQueueFamily
 ) : m_handle(handle),
     m_graphicsQueue(graphicsQueue),
     m_presentQueue(presentQueue),
+    m_transferQueue(transferQueue),
     m_graphicsQueueFamily(graphicsQueueFamily),
-    m_presentQueueFamily(presentQueueFamily)
+    m_presentQueueFamily(presentQueueFamily),
+    m_transferQueueFamily(transferQueueFamily)
 {}
 
 VulkanDevice::~VulkanDevice()
@@ -25,7 +49,8 @@ VulkanDevice::~VulkanDevice()
 }
 
 std::unique_ptr<VulkanDevice> VulkanDevice::Create(
-    const VulkanPhysicalDevice &physicalDevice
+    const VulkanPhysicalDevice &physicalDevice,
+    bool enableSwapchain
 ) {
     VkResult result = VK_SUCCESS;
 
@@ -34,7 +59,8 @@ std::unique_ptr<VulkanDevice> VulkanDevice::Create(
     std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
     std::set<uint32_t> uniqueQueueFamilies = {
         physicalDevice.GetGraphicsQueueFamily(),
-        physicalDevice.GetPresentQueueFamily()
+        physicalDevice.GetPresentQueueFamily(),
+        physicalDevice.GetTransferQueueFamily()
     };
 
     for (uint32_t queueFamily : uniqueQueueFamilies)
@@ -48,20 +74,88 @@ std::unique_ptr<VulkanDevice> VulkanDevice::Create(
         queueCreateInfos.push_back(queueCreateInfo);
     }
 
-    // Features
-    VkPhysicalDeviceFeatures deviceFeatures{};
+    // Extensions, Headless Devices Never Present
+    std::vector<const char*> deviceExtensions;
+    if (enableSwapchain)
+        deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
 
-    // Extensions
-    const std::vector<const char*> deviceExtensions = {
-        VK_KHR_SWAPCHAIN_EXTENSION_NAME
-    };
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice.GetHandle(), &properties);
+
+    bool isVulkan13      = properties.apiVersion >= VK_API_VERSION_1_3;
+    bool hasMaintenance5 = IsExtensionSupported(physicalDevice.GetHandle(), VK_KHR_MAINTENANCE_5_EXTENSION_NAME);
+
+    // Query Supported Features
+    VkPhysicalDeviceMaintenance5FeaturesKHR supportedMaintenance5{};
+    supportedMaintenance5.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_5_FEATURES_KHR;
+
+    VkPhysicalDeviceVulkan13Features supportedVulkan13{};
+    supportedVulkan13.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+
+    VkPhysicalDeviceFeatures2 supportedFeatures{};
+    supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+
+    void **supportedNext = &supportedFeatures.pNext;
+    if (isVulkan13)
+    {
+        *supportedNext = &supportedVulkan13;
+        supportedNext  = &supportedVulkan13.pNext;
+    }
+    if (hasMaintenance5)
+    {
+        *supportedNext = &supportedMaintenance5;
+        supportedNext  = &supportedMaintenance5.pNext;
+    }
+
+    vkGetPhysicalDeviceFeatures2(physicalDevice.GetHandle(), &supportedFeatures);
+
+    // Enabled Features
+    VkPhysicalDeviceFeatures2 deviceFeatures{};
+    deviceFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+
+    void **enabledNext = &deviceFeatures.pNext;
+
+    // Pipeline Statistics Queries, Only Recorded when Requested at Runtime
+    deviceFeatures.features.pipelineStatisticsQuery = supportedFeatures.features.pipelineStatisticsQuery;
+
+    // Vulkan 1.3, Dynamic Rendering and Synchronization 2
+    VkPhysicalDeviceVulkan13Features vulkan13Features{};
+    vulkan13Features.sType            = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+    vulkan13Features.dynamicRendering = isVulkan13 ? supportedVulkan13.dynamicRendering : VK_FALSE;
+    vulkan13Features.synchronization2 = isVulkan13 ? supportedVulkan13.synchronization2 : VK_FALSE;
+
+    if (isVulkan13)
+    {
+        *enabledNext = &vulkan13Features;
+        enabledNext  = &vulkan13Features.pNext;
+    }
+
+    // Maintenance 5, Lets Pipelines Take SPIR-V without a Shader Module
+    VkPhysicalDeviceMaintenance5FeaturesKHR maintenance5Features{};
+    maintenance5Features.sType        = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_5_FEATURES_KHR;
+    maintenance5Features.maintenance5 = hasMaintenance5 ? supportedMaintenance5.maintenance5 : VK_FALSE;
+
+    bool maintenance5Enabled = maintenance5Features.maintenance5 == VK_TRUE;
+    if (maintenance5Enabled)
+    {
+        deviceExtensions.push_back(VK_KHR_MAINTENANCE_5_EXTENSION_NAME);
+
+        *enabledNext = &maintenance5Features;
+        enabledNext  = &maintenance5Features.pNext;
+    }
+
+    // Memory Budget, Reports Heap Usage Including Other Processes
+    bool memoryBudgetEnabled = IsExtensionSupported(physicalDevice.GetHandle(), VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    if (memoryBudgetEnabled)
+        deviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
 
     // Create Info
     VkDeviceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    createInfo.pNext = &deviceFeatures;
     createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
     createInfo.pQueueCreateInfos    = queueCreateInfos.data();
-    createInfo.pEnabledFeatures     = &deviceFeatures;
+    createInfo.pEnabledFeatures     = nullptr;
     createInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
     createInfo.ppEnabledExtensionNames = deviceExtensions.data();
 
@@ -78,24 +172,44 @@ std::unique_ptr<VulkanDevice> VulkanDevice::Create(
     // Get Queue Handles
     VkQueue graphicsQueue = 0;
     VkQueue presentQueue  = 0;
+    VkQueue transferQueue = 0;
     vkGetDeviceQueue(handle, physicalDevice.GetGraphicsQueueFamily(), 0, &graphicsQueue);
     vkGetDeviceQueue(handle, physicalDevice.GetPresentQueueFamily(), 0, &presentQueue);
+    vkGetDeviceQueue(handle, physicalDevice.GetTransferQueueFamily(), 0, &transferQueue);
 
     std::cout << "[INFO]\tLogical Device Created Successfully.\n";
 
-    return std::unique_ptr<VulkanDevice>(
+    auto device = std::unique_ptr<VulkanDevice>(
         new VulkanDevice(
             handle,
             graphicsQueue,
             presentQueue,
+            transferQueue,
             physicalDevice.GetGraphicsQueueFamily(),
-            physicalDevice.GetPresentQueueFamily()
+            physicalDevice.GetPresentQueueFamily(),
+            physicalDevice.GetTransferQueueFamily()
         )
     );
+
+    device->m_maintenance5Enabled       = maintenance5Enabled;
+    device->m_dynamicRenderingEnabled   = vulkan13Features.dynamicRendering == VK_TRUE;
+    device->m_synchronization2Enabled   = vulkan13Features.synchronization2 == VK_TRUE;
+    device->m_pipelineStatisticsEnabled = deviceFeatures.features.pipelineStatisticsQuery == VK_TRUE;
+    device->m_memoryBudgetEnabled       = memoryBudgetEnabled;
+
+    // Caches
+    device->m_layoutCache       = VulkanLayoutCache::Create(handle);
+    device->m_shaderModuleCache = VulkanShaderModuleCache::Create(*device, maintenance5Enabled);
+
+    return device;
 }
 
 void VulkanDevice::Cleanup()
 {
+    // Cached Objects must be Destroyed before the Device
+    m_shaderModuleCache.reset();
+    m_layoutCache.reset();
+
     if (m_handle != VK_NULL_HANDLE)
     {
         vkDestroyDevice(m_handle, nullptr);
@@ -107,8 +221,17 @@ VulkanDevice::VulkanDevice(VulkanDevice &&other) noexcept :
     m_handle(other.m_handle),
     m_graphicsQueue(other.m_graphicsQueue),
     m_presentQueue(other.m_presentQueue),
+    m_transferQueue(other.m_transferQueue),
     m_graphicsQueueFamily(other.m_graphicsQueueFamily),
-    m_presentQueueFamily(other.m_presentQueueFamily)
+    m_presentQueueFamily(other.m_presentQueueFamily),
+    m_transferQueueFamily(other.m_transferQueueFamily),
+    m_maintenance5Enabled(other.m_maintenance5Enabled),
+    m_dynamicRenderingEnabled(other.m_dynamicRenderingEnabled),
+    m_synchronization2Enabled(other.m_synchronization2Enabled),
+    m_pipelineStatisticsEnabled(other.m_pipelineStatisticsEnabled),
+    m_memoryBudgetEnabled(other.m_memoryBudgetEnabled),
+    m_layoutCache(std::move(other.m_layoutCache)),
+    m_shaderModuleCache(std::move(other.m_shaderModuleCache))
 {
     other = VulkanDevice{};
 }
@@ -122,8 +245,17 @@ VulkanDevice& VulkanDevice::operator=(VulkanDevice &&other) noexcept
         m_handle              = other.m_handle;
         m_graphicsQueue       = other.m_graphicsQueue;
         m_presentQueue        = other.m_presentQueue;
+        m_transferQueue       = other.m_transferQueue;
         m_graphicsQueueFamily = other.m_graphicsQueueFamily;
         m_presentQueueFamily  = other.m_presentQueueFamily;
+        m_transferQueueFamily = other.m_transferQueueFamily;
+        m_maintenance5Enabled       = other.m_maintenance5Enabled;
+        m_dynamicRenderingEnabled   = other.m_dynamicRenderingEnabled;
+        m_synchronization2Enabled   = other.m_synchronization2Enabled;
+        m_pipelineStatisticsEnabled = other.m_pipelineStatisticsEnabled;
+        m_memoryBudgetEnabled       = other.m_memoryBudgetEnabled;
+        m_layoutCache         = std::move(other.m_layoutCache);
+        m_shaderModuleCache   = std::move(other.m_shaderModuleCache);
 
         other = VulkanDevice{};
     }
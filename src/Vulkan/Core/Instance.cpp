@@ -1,14 +1,34 @@
 #include "Vulkan/Core/Instance.hpp"
 
+#include <cstring>
 #include <iostream>
 #include <vector>
 
 #define GLFW_NO_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
 
+static bool IsLayerSupported(const char *layerName)
+{
+    uint32_t layerCount = 0;
+    vkEnumerateInstanceLayerProperties(&layerCount, nullptr);
+
+    std::vector<VkLayerProperties> layers(layerCount);
+    vkEnumerateInstanceLayerProperties(&layerCount, layers.data());
+
+    for (const auto &layer : layers)
+    {
+        if (std::strcmp(layer.layerName, layerName) == 0)
+            return true;
+    }
+
+    return false;
+}
+
 VulkanInstance::VulkanInstance(
-    VkInstance handle
-) : m_handle(handle)
+    VkInstance handle,
+    bool       debugUtilsEnabled
+) : m_handle(handle),
+    m_debugUtilsEnabled(debugUtilsEnabled)
 {}
 
 VulkanInstance::~VulkanInstance()
@@ -20,7 +40,8 @@ std::unique_ptr<VulkanInstance> VulkanInstance::Create(
     const std::string &appName,
     uint32_t          appVersion,
     const std::string &engineName,
-    uint32_t          engineVersion
+    uint32_t          engineVersion,
+    bool              headless
 ) {
     VkResult result = VK_SUCCESS;
 
@@ -49,21 +70,39 @@ std::unique_ptr<VulkanInstance> VulkanInstance::Create(
     for (const auto &vulkanExtension : vulkanExtensions)
         std::cout << "[INFO]\t  " << vulkanExtension.extensionName << '\n';
     
-    // Extensions
-    uint32_t glfwExtensionCount = 0;
-    const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+    // Extensions, Surface Extensions are Only Needed to Present
+    std::vector<const char*> extensions;
+    if (!headless)
+    {
+        uint32_t glfwExtensionCount = 0;
+        const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
 
-    std::vector<const char*> extensions(glfwExtensions, glfwExtensions + glfwExtensionCount);
+        extensions.assign(glfwExtensions, glfwExtensions + glfwExtensionCount);
+    }
 
-    extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    // Debug Utils is Optional, Software Drivers and CI Machines Often Lack It
+    bool debugUtilsEnabled = false;
+    for (const auto &vulkanExtension : vulkanExtensions)
+    {
+        if (std::strcmp(vulkanExtension.extensionName, VK_EXT_DEBUG_UTILS_EXTENSION_NAME) == 0)
+            debugUtilsEnabled = true;
+    }
+
+    if (debugUtilsEnabled)
+        extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    else
+        std::cerr << "[WARNING]\t" << VK_EXT_DEBUG_UTILS_EXTENSION_NAME << " not Available, Debug Messenger Disabled.\n";
 
     createInfo.enabledExtensionCount   = static_cast<uint32_t>(extensions.size());
     createInfo.ppEnabledExtensionNames = extensions.data();
 
     // Layers
-    const std::vector<const char*> layers = {
-        "VK_LAYER_KHRONOS_validation"
-    };
+    std::vector<const char*> layers;
+    if (IsLayerSupported("VK_LAYER_KHRONOS_validation"))
+        layers.push_back("VK_LAYER_KHRONOS_validation");
+    else
+        std::cerr << "[WARNING]\tVK_LAYER_KHRONOS_validation not Available, Validation Disabled.\n";
+
     createInfo.enabledLayerCount   = static_cast<uint32_t>(layers.size());
     createInfo.ppEnabledLayerNames = layers.data();
 
@@ -81,7 +120,8 @@ std::unique_ptr<VulkanInstance> VulkanInstance::Create(
     
     return std::unique_ptr<VulkanInstance>(
         new VulkanInstance(
-            handle
+            handle,
+            debugUtilsEnabled
         )
     );
 }
@@ -97,7 +137,8 @@ void VulkanInstance::Cleanup()
 }
 
 VulkanInstance::VulkanInstance(VulkanInstance &&other) noexcept : 
-    m_handle(other.m_handle)
+    m_handle(other.m_handle),
+    m_debugUtilsEnabled(other.m_debugUtilsEnabled)
 {
     other = VulkanInstance{};
 }
@@ -108,7 +149,8 @@ VulkanInstance& VulkanInstance::operator=(VulkanInstance &&other) noexcept
     {
         Cleanup();
         
-        m_handle = other.m_handle;
+        m_handle            = other.m_handle;
+        m_debugUtilsEnabled = other.m_debugUtilsEnabled;
 
         other = VulkanInstance{};
     }
@@ -6,20 +6,24 @@
 #include "Vulkan/Core/Instance.hpp"
 #include "Vulkan/Core/Surface.hpp"
 
+#include "Settings.hpp"
+
 VulkanPhysicalDevice::VulkanPhysicalDevice(
     VkPhysicalDevice handle,
     uint32_t         graphicsQueueFamily,
-    uint32_t         presentQueueFamily
+    uint32_t         presentQueueFamily,
+    uint32_t         transferQueueFamily
 ) : m_handle(handle),
     m_graphicsQueueFamily(graphicsQueueFamily),
-    m_presentQueueFamily(presentQueueFamily)
+    m_presentQueueFamily(presentQueueFamily),
+    m_transferQueueFamily(transferQueueFamily)
 {}
 
 VulkanPhysicalDevice::~VulkanPhysicalDevice() = default;
 
 std::unique_ptr<VulkanPhysicalDevice> VulkanPhysicalDevice::Create(
     const VulkanInstance &instance,
-    const VulkanSurface  &surface
+    const VulkanSurface  *surface
 ) {
     VkResult result = VK_SUCCESS;
 
@@ -39,33 +43,61 @@ std::unique_ptr<VulkanPhysicalDevice> VulkanPhysicalDevice::Create(
     VkPhysicalDevice handle              = VK_NULL_HANDLE;
     uint32_t         graphicsQueueFamily = VK_QUEUE_FAMILY_IGNORED;
     uint32_t         presentQueueFamily  = VK_QUEUE_FAMILY_IGNORED;
+    uint32_t         transferQueueFamily = VK_QUEUE_FAMILY_IGNORED;
+
+    VkSurfaceKHR vkSurface = surface ? surface->GetHandle() : VK_NULL_HANDLE;
 
     for (const auto &deviceCandidate : devices)
     {
-        QueueFamilyIndices indices = VulkanPhysicalDevice::FindQueueFamilies(surface.GetHandle(), deviceCandidate);
+        QueueFamilyIndices indices = VulkanPhysicalDevice::FindQueueFamilies(vkSurface, deviceCandidate);
         if (indices.isComplete())
         {
             handle              = deviceCandidate;
             graphicsQueueFamily = indices.graphicsFamily.value();
             presentQueueFamily  = indices.presentFamily.value();
+            transferQueueFamily = ENABLE_TRANSFER_QUEUE ? indices.transferFamily.value_or(graphicsQueueFamily) : graphicsQueueFamily;
             break;
         }
     }
 
     if (handle == VK_NULL_HANDLE)
         throw std::runtime_error("Failed to find a Suitable GPU.");
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(handle, &properties);
     
-    std::cout << "[INFO]\tPhysical Device Selected Successfully.\n";
+    std::cout << "[INFO]\tPhysical Device Selected Successfully: " << properties.deviceName << "\n";
+
+    if (transferQueueFamily != graphicsQueueFamily)
+        std::cout << "[INFO]\tUploads Use Transfer Queue Family " << transferQueueFamily << ".\n";
 
     return std::unique_ptr<VulkanPhysicalDevice>(
         new VulkanPhysicalDevice(
             handle,
             graphicsQueueFamily,
-            presentQueueFamily
+            presentQueueFamily,
+            transferQueueFamily
         )
     );
 }
 
+VkSampleCountFlagBits VulkanPhysicalDevice::ClampSampleCount(uint32_t requestedSamples) const
+{
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(m_handle, &properties);
+
+    VkSampleCountFlags supported = properties.limits.framebufferColorSampleCounts &
+                                   properties.limits.framebufferDepthSampleCounts;
+
+    for (uint32_t samples = VK_SAMPLE_COUNT_64_BIT; samples > VK_SAMPLE_COUNT_1_BIT; samples >>= 1)
+    {
+        if (samples <= requestedSamples && (supported & samples))
+            return static_cast<VkSampleCountFlagBits>(samples);
+    }
+
+    return VK_SAMPLE_COUNT_1_BIT;
+}
+
 bool VulkanPhysicalDevice::IsDeviceSuitable(VkSurfaceKHR vkSurface, VkPhysicalDevice vkPhysicalDevice)
 {
     QueueFamilyIndices indices = FindQueueFamilies(vkSurface, vkPhysicalDevice);
@@ -82,6 +114,21 @@ QueueFamilyIndices VulkanPhysicalDevice::FindQueueFamilies(VkSurfaceKHR vkSurfac
     vkGetPhysicalDeviceQueueFamilyProperties(vkPhysicalDevice, &queueFamilyCount, queueFamilies.data());
 
     QueueFamilyIndices indices;
+
+    // A Family that Only Copies is the DMA Engine, Compute-Capable Ones are Second Choice
+    for (uint32_t i = 0; i < queueFamilies.size(); ++i)
+    {
+        VkQueueFlags flags = queueFamilies[i].queueFlags;
+        if (!(flags & VK_QUEUE_TRANSFER_BIT) || (flags & VK_QUEUE_GRAPHICS_BIT))
+            continue;
+
+        if (!indices.transferFamily || !(flags & VK_QUEUE_COMPUTE_BIT))
+            indices.transferFamily = i;
+
+        if (!(flags & VK_QUEUE_COMPUTE_BIT))
+            break;
+    }
+
     for (uint32_t i = 0; i < queueFamilies.size(); ++i)
     {
         const auto &queueFamily = queueFamilies[i];
@@ -89,6 +136,17 @@ QueueFamilyIndices VulkanPhysicalDevice::FindQueueFamilies(VkSurfaceKHR vkSurfac
         if (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT)
             indices.graphicsFamily = i;
 
+        // Headless, Nothing is Presented so the Graphics Queue Stands In
+        if (vkSurface == VK_NULL_HANDLE)
+        {
+            indices.presentFamily = indices.graphicsFamily;
+
+            if (indices.isComplete())
+                break;
+
+            continue;
+        }
+
         VkBool32 presentSupport = false;
         vkGetPhysicalDeviceSurfaceSupportKHR(vkPhysicalDevice, i, vkSurface, &presentSupport);
         
@@ -105,7 +163,8 @@ QueueFamilyIndices VulkanPhysicalDevice::FindQueueFamilies(VkSurfaceKHR vkSurfac
 VulkanPhysicalDevice::VulkanPhysicalDevice(VulkanPhysicalDevice &&other) noexcept : 
     m_handle(other.m_handle),
     m_graphicsQueueFamily(other.m_graphicsQueueFamily),
-    m_presentQueueFamily(other.m_presentQueueFamily)
+    m_presentQueueFamily(other.m_presentQueueFamily),
+    m_transferQueueFamily(other.m_transferQueueFamily)
 {
     other = VulkanPhysicalDevice{};
 }
@@ -117,6 +176,7 @@ VulkanPhysicalDevice& VulkanPhysicalDevice::operator=(VulkanPhysicalDevice &&oth
         m_handle              = other.m_handle;
         m_graphicsQueueFamily = other.m_graphicsQueueFamily;
         m_presentQueueFamily  = other.m_presentQueueFamily;
+        m_transferQueueFamily = other.m_transferQueueFamily;
 
         other = VulkanPhysicalDevice{};
     }
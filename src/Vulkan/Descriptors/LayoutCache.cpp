@@ -0,0 +1,206 @@
+#include "Vulkan/Descriptors/LayoutCache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+
+#include "Utils.hpp"
+
+bool VulkanDescriptorSetLayoutKey::operator==(const VulkanDescriptorSetLayoutKey &other) const
+{
+    if (bindings.size() != other.bindings.size())
+        return false;
+
+    for (size_t i = 0; i < bindings.size(); ++i)
+    {
+        const auto &a = bindings[i];
+        const auto &b = other.bindings[i];
+
+        if (a.binding         != b.binding         ||
+            a.descriptorType  != b.descriptorType  ||
+            a.descriptorCount != b.descriptorCount ||
+            a.stageFlags      != b.stageFlags)
+            return false;
+    }
+
+    return true;
+}
+
+bool VulkanPipelineLayoutKey::operator==(const VulkanPipelineLayoutKey &other) const
+{
+    if (setLayouts != other.setLayouts)
+        return false;
+
+    if (pushConstantRanges.size() != other.pushConstantRanges.size())
+        return false;
+
+    for (size_t i = 0; i < pushConstantRanges.size(); ++i)
+    {
+        const auto &a = pushConstantRanges[i];
+        const auto &b = other.pushConstantRanges[i];
+
+        if (a.stageFlags != b.stageFlags ||
+            a.offset     != b.offset     ||
+            a.size       != b.size)
+            return false;
+    }
+
+    return true;
+}
+
+size_t VulkanDescriptorSetLayoutKeyHash::operator()(const VulkanDescriptorSetLayoutKey &key) const
+{
+    size_t seed = key.bindings.size();
+
+    for (const auto &binding : key.bindings)
+    {
+        hashCombine(seed, binding.binding);
+        hashCombine(seed, binding.descriptorType);
+        hashCombine(seed, binding.descriptorCount);
+        hashCombine(seed, binding.stageFlags);
+    }
+
+    return seed;
+}
+
+size_t VulkanPipelineLayoutKeyHash::operator()(const VulkanPipelineLayoutKey &key) const
+{
+    size_t seed = key.setLayouts.size();
+
+    for (VkDescriptorSetLayout setLayout : key.setLayouts)
+        hashCombine(seed, std::hash<VkDescriptorSetLayout>{}(setLayout));
+
+    for (const auto &range : key.pushConstantRanges)
+    {
+        hashCombine(seed, range.stageFlags);
+        hashCombine(seed, range.offset);
+        hashCombine(seed, range.size);
+    }
+
+    return seed;
+}
+
+VulkanLayoutCache::VulkanLayoutCache(VkDevice device) :
+    m_device(device)
+{}
+
+VulkanLayoutCache::~VulkanLayoutCache()
+{
+    Cleanup();
+}
+
+std::unique_ptr<VulkanLayoutCache> VulkanLayoutCache::Create(VkDevice device)
+{
+    return std::unique_ptr<VulkanLayoutCache>(
+        new VulkanLayoutCache(device)
+    );
+}
+
+VkDescriptorSetLayout VulkanLayoutCache::GetDescriptorSetLayout(
+    const std::vector<VkDescriptorSetLayoutBinding> &bindings
+) {
+    // Sort Bindings so Declaration Order does not Matter
+    VulkanDescriptorSetLayoutKey key{bindings};
+    std::sort(
+        key.bindings.begin(),
+        key.bindings.end(),
+        [](const VkDescriptorSetLayoutBinding &a, const VkDescriptorSetLayoutBinding &b) {
+            return a.binding < b.binding;
+        }
+    );
+
+    for (const auto &binding : key.bindings)
+    {
+        if (binding.pImmutableSamplers != nullptr)
+            throw std::runtime_error("Layout Cache does not Support Immutable Samplers.");
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_descriptorSetLayouts.find(key);
+    if (it != m_descriptorSetLayouts.end())
+        return it->second;
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = static_cast<uint32_t>(key.bindings.size());
+    layoutInfo.pBindings    = key.bindings.data();
+
+    // Create Descriptor Set Layout
+    VkDescriptorSetLayout handle = VK_NULL_HANDLE;
+    VkResult result = vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &handle);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "[ERROR]\t'vkCreateDescriptorSetLayout' Failed with Error Code " << result << "\n";
+
+        throw std::runtime_error("Failed to Create Descriptor Set Layout.");
+    }
+
+    m_descriptorSetLayouts.emplace(std::move(key), handle);
+
+    return handle;
+}
+
+std::vector<VkDescriptorSetLayoutBinding> VulkanLayoutCache::GetDescriptorSetLayoutBindings(
+    VkDescriptorSetLayout setLayout
+) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto &[key, handle] : m_descriptorSetLayouts)
+    {
+        if (handle == setLayout)
+            return key.bindings;
+    }
+
+    throw std::runtime_error("Descriptor Set Layout is not Owned by the Layout Cache.");
+}
+
+VkPipelineLayout VulkanLayoutCache::GetPipelineLayout(
+    const std::vector<VkDescriptorSetLayout> &setLayouts,
+    const std::vector<VkPushConstantRange>   &pushConstantRanges
+) {
+    VulkanPipelineLayoutKey key{setLayouts, pushConstantRanges};
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_pipelineLayouts.find(key);
+    if (it != m_pipelineLayouts.end())
+        return it->second;
+
+    VkPipelineLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount         = static_cast<uint32_t>(key.setLayouts.size());
+    layoutInfo.pSetLayouts            = key.setLayouts.data();
+    layoutInfo.pushConstantRangeCount = static_cast<uint32_t>(key.pushConstantRanges.size());
+    layoutInfo.pPushConstantRanges    = key.pushConstantRanges.data();
+
+    // Create Pipeline Layout
+    VkPipelineLayout handle = VK_NULL_HANDLE;
+    VkResult result = vkCreatePipelineLayout(m_device, &layoutInfo, nullptr, &handle);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "[ERROR]\t'vkCreatePipelineLayout' Failed with Error Code " << result << "\n";
+
+        throw std::runtime_error("Failed to Create Pipeline Layout.");
+    }
+
+    std::cout << "[INFO]\tPipeline Layout Created Successfully.\n";
+
+    m_pipelineLayouts.emplace(std::move(key), handle);
+
+    return handle;
+}
+
+void VulkanLayoutCache::Cleanup()
+{
+    // Destroy Pipeline Layouts
+    for (auto &[key, handle] : m_pipelineLayouts)
+        vkDestroyPipelineLayout(m_device, handle, nullptr);
+    m_pipelineLayouts.clear();
+
+    // Destroy Descriptor Set Layouts
+    for (auto &[key, handle] : m_descriptorSetLayouts)
+        vkDestroyDescriptorSetLayout(m_device, handle, nullptr);
+    m_descriptorSetLayouts.clear();
+}
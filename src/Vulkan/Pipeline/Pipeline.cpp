@@ -1,34 +1,313 @@
 #include "Vulkan/Pipeline/Pipeline.hpp"
 
+#include <algorithm>
 #include <array>
 #include <iostream>
+#include <map>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "Vulkan/Core/Device.hpp"
+#include "Vulkan/Descriptors/LayoutCache.hpp"
 #include "Vulkan/Swapchain/Swapchain.hpp"
 #include "Vulkan/Swapchain/Framebuffer.hpp"
 #include "Vulkan/RenderPass/RenderPass.hpp"
 
 #include "Vulkan/Pipeline/ShaderModule.hpp"
+#include "Vulkan/Pipeline/ShaderModuleCache.hpp"
+
+#include "Utils.hpp"
 
 #include "Vulkan/Sync/Sync.hpp"
 #include "Vulkan/Sync/Semaphore.hpp"
 #include "Vulkan/Sync/Fence.hpp"
 
+#include "Profiling/CpuProfiler.hpp"
+
 VulkanPipeline::VulkanPipeline(
     const VulkanDevice &device,
     VkPipeline       handle,
-    VkPipelineLayout layout,
-    std::unique_ptr<VulkanShaderModule> vertexShaderModule,
-    std::unique_ptr<VulkanShaderModule> pixelShaderModule
+    VkPipelineLayout layout
 ) : m_device(device),
     m_handle(handle),
-    m_layout(layout),
-    m_vertexShaderModule(std::move(vertexShaderModule)),
-    m_pixelShaderModule(std::move(pixelShaderModule))
+    m_layout(layout)
 {}
 
+void VulkanPipelineDesc::SetSpecializationConstantBits(
+    VkShaderStageFlags stageFlags,
+    uint32_t constantId,
+    uint32_t bits
+) {
+    // A Stage Holds One Value per Constant ID
+    for (auto &constant : specializationConstants)
+    {
+        if (constant.constantId == constantId)
+            constant.stageFlags &= ~stageFlags;
+    }
+    std::erase_if(
+        specializationConstants,
+        [](const VulkanSpecializationConstant &constant) { return constant.stageFlags == 0; }
+    );
+
+    VulkanSpecializationConstant constant{ stageFlags, constantId, bits };
+
+    auto it = std::upper_bound(
+        specializationConstants.begin(),
+        specializationConstants.end(),
+        constant,
+        [](const VulkanSpecializationConstant &a, const VulkanSpecializationConstant &b) {
+            return a.constantId != b.constantId ? a.constantId < b.constantId : a.stageFlags < b.stageFlags;
+        }
+    );
+    specializationConstants.insert(it, constant);
+}
+
+bool VulkanPipelineDesc::operator==(const VulkanPipelineDesc &other) const
+{
+    if (vertexShaderPath        != other.vertexShaderPath ||
+        pixelShaderPath         != other.pixelShaderPath  ||
+        setLayouts              != other.setLayouts       ||
+        specializationConstants != other.specializationConstants ||
+        attributeOffsets        != other.attributeOffsets ||
+        colorFormats            != other.colorFormats     ||
+        depthFormat             != other.depthFormat      ||
+        samples                 != other.samples)
+        return false;
+
+    if (bindingDescs.size() != other.bindingDescs.size())
+        return false;
+
+    for (size_t i = 0; i < bindingDescs.size(); ++i)
+    {
+        const auto &a = bindingDescs[i];
+        const auto &b = other.bindingDescs[i];
+
+        if (a.binding   != b.binding ||
+            a.stride    != b.stride  ||
+            a.inputRate != b.inputRate)
+            return false;
+    }
+
+    return true;
+}
+
+size_t VulkanPipelineDescHash::operator()(const VulkanPipelineDesc &desc) const
+{
+    size_t seed = 0;
+
+    hashCombine(seed, std::hash<std::string>{}(desc.vertexShaderPath));
+    hashCombine(seed, std::hash<std::string>{}(desc.pixelShaderPath));
+
+    for (const auto &bindingDesc : desc.bindingDescs)
+    {
+        hashCombine(seed, bindingDesc.binding);
+        hashCombine(seed, bindingDesc.stride);
+        hashCombine(seed, bindingDesc.inputRate);
+    }
+
+    for (uint32_t offset : desc.attributeOffsets)
+        hashCombine(seed, offset);
+
+    for (VkDescriptorSetLayout setLayout : desc.setLayouts)
+        hashCombine(seed, std::hash<VkDescriptorSetLayout>{}(setLayout));
+
+    for (const auto &constant : desc.specializationConstants)
+    {
+        hashCombine(seed, constant.stageFlags);
+        hashCombine(seed, constant.constantId);
+        hashCombine(seed, constant.value);
+    }
+
+    for (VkFormat format : desc.colorFormats)
+        hashCombine(seed, format);
+    hashCombine(seed, desc.depthFormat);
+    hashCombine(seed, desc.samples);
+
+    return seed;
+}
+
+// Gather the Constants Set on a Stage, Checked Against its Reflection
+static void GetSpecializationData(
+    const VulkanPipelineDesc     &desc,
+    const VulkanShaderReflection &reflection,
+    const std::string            &shaderPath,
+    std::vector<VkSpecializationMapEntry> &entries,
+    std::vector<uint32_t>                 &data
+) {
+    for (const auto &constant : desc.specializationConstants)
+    {
+        if ((constant.stageFlags & reflection.stage) == 0)
+            continue;
+
+        bool isDeclared = std::binary_search(
+            reflection.specializationConstantIds.begin(),
+            reflection.specializationConstantIds.end(),
+            constant.constantId
+        );
+        if (!isDeclared)
+        {
+            throw std::runtime_error(
+                "Shader '" + shaderPath + "' Declares no Specialization Constant " +
+                std::to_string(constant.constantId) + "."
+            );
+        }
+
+        VkSpecializationMapEntry entry{};
+        entry.constantID = constant.constantId;
+        entry.offset     = static_cast<uint32_t>(data.size() * sizeof(uint32_t));
+        entry.size       = sizeof(uint32_t);
+
+        entries.push_back(entry);
+        data.push_back(constant.value);
+    }
+}
+
+// Inputs Read from Binding 0 at the Desc's Offsets, or Tightly Packed in Location Order when it Gives None
+static std::vector<VkVertexInputAttributeDescription> GetVertexAttributes(
+    const VulkanShaderReflection &reflection,
+    const VulkanPipelineDesc     &desc
+) {
+    std::vector<VkVertexInputAttributeDescription> attrDescs;
+
+    if (reflection.inputs.empty())
+        return attrDescs;
+
+    if (desc.bindingDescs.empty())
+        throw std::runtime_error("Vertex Shader Declares Inputs but no Vertex Binding was Provided.");
+
+    const VkVertexInputBindingDescription &bindingDesc = desc.bindingDescs[0];
+
+    bool isPacked = desc.attributeOffsets.empty();
+    if (!isPacked && desc.attributeOffsets.size() != reflection.inputs.size())
+    {
+        throw std::runtime_error(
+            "Vertex Shader Declares " + std::to_string(reflection.inputs.size()) +
+            " Inputs but " + std::to_string(desc.attributeOffsets.size()) + " Attribute Offsets were Provided."
+        );
+    }
+
+    uint32_t offset = 0;
+    for (size_t i = 0; i < reflection.inputs.size(); ++i)
+    {
+        const auto &input = reflection.inputs[i];
+
+        if (!isPacked)
+            offset = desc.attributeOffsets[i];
+
+        if (offset + input.size > bindingDesc.stride)
+        {
+            throw std::runtime_error(
+                "Vertex Input at Location " + std::to_string(input.location) + " Ends at Byte " +
+                std::to_string(offset + input.size) + ", Past the Vertex Binding Stride of " +
+                std::to_string(bindingDesc.stride) + "."
+            );
+        }
+
+        VkVertexInputAttributeDescription attrDesc{};
+        attrDesc.binding  = bindingDesc.binding;
+        attrDesc.location = input.location;
+        attrDesc.format   = input.format;
+        attrDesc.offset   = offset;
+
+        attrDescs.push_back(attrDesc);
+        offset += input.size;
+    }
+
+    // Padding Between Packed Inputs would Shift Every Later Offset, so Only an Exact Fit is Trusted
+    if (isPacked && offset != bindingDesc.stride)
+    {
+        throw std::runtime_error(
+            "Vertex Shader Inputs Span " + std::to_string(offset) +
+            " Bytes but the Vertex Binding Stride is " + std::to_string(bindingDesc.stride) +
+            ", Provide Attribute Offsets for Padded Vertices."
+        );
+    }
+
+    return attrDescs;
+}
+
+// Merge Bindings of Every Stage, Keyed by Set then Binding
+static std::map<std::pair<uint32_t, uint32_t>, VkDescriptorSetLayoutBinding> GetDescriptorBindings(
+    const std::vector<const VulkanShaderReflection*> &reflections
+) {
+    std::map<std::pair<uint32_t, uint32_t>, VkDescriptorSetLayoutBinding> bindings;
+
+    for (const auto *reflection : reflections)
+    {
+        for (const auto &shaderBinding : reflection->descriptorBindings)
+        {
+            auto [it, inserted] = bindings.try_emplace({ shaderBinding.set, shaderBinding.binding });
+
+            VkDescriptorSetLayoutBinding &binding = it->second;
+            if (inserted)
+            {
+                binding.binding         = shaderBinding.binding;
+                binding.descriptorType  = shaderBinding.type;
+                binding.descriptorCount = shaderBinding.count;
+            }
+            else if (binding.descriptorType  != shaderBinding.type ||
+                     binding.descriptorCount != shaderBinding.count)
+            {
+                throw std::runtime_error("Shader Stages Disagree on Descriptor '" + shaderBinding.name + "'.");
+            }
+
+            binding.stageFlags |= reflection->stage;
+        }
+    }
+
+    return bindings;
+}
+
+// Build Set Layouts from Reflection, or Check the Provided Ones Against It
+static void ResolveDescriptorSetLayouts(
+    const VulkanDevice &device,
+    const std::map<std::pair<uint32_t, uint32_t>, VkDescriptorSetLayoutBinding> &bindings,
+    std::vector<VkDescriptorSetLayout> &layoutDescs
+) {
+    VulkanLayoutCache &layoutCache = device.GetLayoutCache();
+
+    if (layoutDescs.empty())
+    {
+        uint32_t setCount = bindings.empty() ? 0 : bindings.rbegin()->first.first + 1;
+
+        std::vector<std::vector<VkDescriptorSetLayoutBinding>> setBindings(setCount);
+        for (const auto &[key, binding] : bindings)
+            setBindings[key.first].push_back(binding);
+
+        for (const auto &set : setBindings)
+            layoutDescs.push_back(layoutCache.GetDescriptorSetLayout(set));
+
+        return;
+    }
+
+    for (const auto &[key, binding] : bindings)
+    {
+        auto [set, index] = key;
+
+        if (set >= layoutDescs.size())
+            throw std::runtime_error("Shader Uses Descriptor Set " + std::to_string(set) + " which has no Layout.");
+
+        auto layoutBindings = layoutCache.GetDescriptorSetLayoutBindings(layoutDescs[set]);
+        auto it = std::find_if(
+            layoutBindings.begin(),
+            layoutBindings.end(),
+            [index](const VkDescriptorSetLayoutBinding &b) { return b.binding == index; }
+        );
+
+        std::string location = "Set " + std::to_string(set) + " Binding " + std::to_string(index);
+
+        if (it == layoutBindings.end())
+            throw std::runtime_error("Descriptor Set Layout is Missing " + location + ".");
+        if (it->descriptorType != binding.descriptorType)
+            throw std::runtime_error("Descriptor Type Mismatch at " + location + ".");
+        if (binding.descriptorCount != 0 && it->descriptorCount < binding.descriptorCount)
+            throw std::runtime_error("Descriptor Count Mismatch at " + location + ".");
+        if ((it->stageFlags & binding.stageFlags) != binding.stageFlags)
+            throw std::runtime_error("Descriptor Stage Flags Mismatch at " + location + ".");
+    }
+}
+
 VulkanPipeline::~VulkanPipeline()
 {
     Cleanup();
@@ -37,16 +316,46 @@ VulkanPipeline::~VulkanPipeline()
 std::unique_ptr<VulkanPipeline> VulkanPipeline::Create(
     const VulkanDevice     &device,
     const VulkanSwapchain  &swapchain,
-    const VulkanRenderPass &renderPass,
-    std::vector<VkVertexInputBindingDescription>   &bindingDescs,
-    std::vector<VkVertexInputAttributeDescription> &attrDescs,
-    std::vector<VkDescriptorSetLayout>             &layoutDescs,
-    uint32_t frameCount
+    const VulkanRenderPass *renderPass,
+    const VulkanPipelineDesc &desc,
+    uint32_t        frameCount,
+    VkPipelineCache pipelineCache
 ) {
     VkResult result = VK_SUCCESS;
 
-    auto vertexShaderModule = VulkanShaderModule::Create(device, "assets/shaders/renderVS.spv");
-    auto pixelShaderModule  = VulkanShaderModule::Create(device, "assets/shaders/renderPS.spv");
+    const std::vector<VkVertexInputBindingDescription> &bindingDescs = desc.bindingDescs;
+    std::vector<VkDescriptorSetLayout>                  layoutDescs  = desc.setLayouts;
+
+    // Shared Modules, Released Once the Pipeline Exists
+    auto vertexShaderModule = device.GetShaderModuleCache().Load(desc.vertexShaderPath);
+    auto pixelShaderModule  = device.GetShaderModuleCache().Load(desc.pixelShaderPath);
+
+    const VulkanShaderReflection &vertexReflection = vertexShaderModule->GetReflection();
+    const VulkanShaderReflection &pixelReflection  = pixelShaderModule->GetReflection();
+
+    if (vertexReflection.stage != VK_SHADER_STAGE_VERTEX_BIT || pixelReflection.stage != VK_SHADER_STAGE_FRAGMENT_BIT)
+        throw std::runtime_error("Graphics Pipeline Shader Stages do not Match their Entry Points.");
+
+    // Vertex Attributes
+    std::vector<VkVertexInputAttributeDescription> attrDescs = GetVertexAttributes(vertexReflection, desc);
+
+    // Descriptor Set Layouts
+    ResolveDescriptorSetLayouts(
+        device,
+        GetDescriptorBindings({ &vertexReflection, &pixelReflection }),
+        layoutDescs
+    );
+
+    // Push Constant Ranges
+    std::vector<VkPushConstantRange> pushConstantRanges;
+    for (const auto *reflection : { &vertexReflection, &pixelReflection })
+    {
+        pushConstantRanges.insert(
+            pushConstantRanges.end(),
+            reflection->pushConstantRanges.begin(),
+            reflection->pushConstantRanges.end()
+        );
+    }
 
     // Vertex Input
     VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
@@ -99,7 +408,16 @@ std::unique_ptr<VulkanPipeline> VulkanPipeline::Create(
     VkPipelineMultisampleStateCreateInfo multisampling{};
     multisampling.sType                = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
     multisampling.sampleShadingEnable  = VK_FALSE;
-    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    multisampling.rasterizationSamples = desc.samples;
+
+    // Depth Testing, Reverse-Z Keeps Nearer Fragments at Greater Depth
+    VkPipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.sType                 = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable       = VK_TRUE;
+    depthStencil.depthWriteEnable      = VK_TRUE;
+    depthStencil.depthCompareOp        = VK_COMPARE_OP_GREATER_OR_EQUAL;
+    depthStencil.depthBoundsTestEnable = VK_FALSE;
+    depthStencil.stencilTestEnable     = VK_FALSE;
 
     // Color Blending
     VkPipelineColorBlendAttachmentState colorBlendAttachment{};
@@ -115,38 +433,62 @@ std::unique_ptr<VulkanPipeline> VulkanPipeline::Create(
     colorBlending.attachmentCount = 1;
     colorBlending.pAttachments    = &colorBlendAttachment;
 
+    // Attachment Formats for Dynamic Rendering
+    if (!renderPass && desc.colorFormats.size() != 1)
+        throw std::runtime_error("Dynamic Rendering Pipelines Need Exactly One Color Format.");
+
+    VkPipelineRenderingCreateInfo renderingInfo{};
+    renderingInfo.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO;
+    renderingInfo.colorAttachmentCount    = static_cast<uint32_t>(desc.colorFormats.size());
+    renderingInfo.pColorAttachmentFormats = desc.colorFormats.data();
+    renderingInfo.depthAttachmentFormat   = desc.depthFormat;
+
+    // Specialization Constants
+    std::vector<VkSpecializationMapEntry> vertexSpecEntries, pixelSpecEntries;
+    std::vector<uint32_t>                 vertexSpecData,    pixelSpecData;
+
+    GetSpecializationData(desc, vertexReflection, desc.vertexShaderPath, vertexSpecEntries, vertexSpecData);
+    GetSpecializationData(desc, pixelReflection,  desc.pixelShaderPath,  pixelSpecEntries,  pixelSpecData);
+
+    VkSpecializationInfo vertexSpecInfo{
+        static_cast<uint32_t>(vertexSpecEntries.size()), vertexSpecEntries.data(),
+        vertexSpecData.size() * sizeof(uint32_t),        vertexSpecData.data()
+    };
+    VkSpecializationInfo pixelSpecInfo{
+        static_cast<uint32_t>(pixelSpecEntries.size()), pixelSpecEntries.data(),
+        pixelSpecData.size() * sizeof(uint32_t),        pixelSpecData.data()
+    };
+
+    // Inline Code when Modules were Skipped (VK_KHR_maintenance5)
+    VkShaderModuleCreateInfo vertexCodeInfo = vertexShaderModule->GetCreateInfo();
+    VkShaderModuleCreateInfo pixelCodeInfo  = pixelShaderModule->GetCreateInfo();
+
     // Shader Stages
     VkPipelineShaderStageCreateInfo shaderStages[] = {
         {
             VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, nullptr, 0,
-            VK_SHADER_STAGE_VERTEX_BIT, vertexShaderModule->GetHandle(), "main", nullptr 
+            VK_SHADER_STAGE_VERTEX_BIT, vertexShaderModule->GetHandle(), vertexReflection.entryPoint.c_str(),
+            vertexSpecEntries.empty() ? nullptr : &vertexSpecInfo
         },
         {
             VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, nullptr, 0,
-            VK_SHADER_STAGE_FRAGMENT_BIT, pixelShaderModule->GetHandle(), "main", nullptr
+            VK_SHADER_STAGE_FRAGMENT_BIT, pixelShaderModule->GetHandle(), pixelReflection.entryPoint.c_str(),
+            pixelSpecEntries.empty() ? nullptr : &pixelSpecInfo
         }
     };
 
-    VkPipelineLayoutCreateInfo graphicsPipelineLayoutInfo{};
-    graphicsPipelineLayoutInfo.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    graphicsPipelineLayoutInfo.setLayoutCount         = static_cast<uint32_t>(layoutDescs.size());
-    graphicsPipelineLayoutInfo.pSetLayouts            = layoutDescs.data();
-
-    // Create Pipeline Layout
-    VkPipelineLayout layout = VK_NULL_HANDLE;
-    result = vkCreatePipelineLayout(device.GetHandle(), &graphicsPipelineLayoutInfo, nullptr, &layout);
-    if (result != VK_SUCCESS)
-    {
-        std::cerr << "[ERROR]\t'vkCreatePipelineLayout' Failed with Error Code " << result << "\n";
-
-        throw std::runtime_error("Failed to create Graphics Pipeline Layout.");
-    }
+    if (vertexShaderModule->GetHandle() == VK_NULL_HANDLE)
+        shaderStages[0].pNext = &vertexCodeInfo;
+    if (pixelShaderModule->GetHandle() == VK_NULL_HANDLE)
+        shaderStages[1].pNext = &pixelCodeInfo;
 
-    std::cout << "[INFO]\tGraphics Pipeline Layout Created Successfully.\n";
+    // Pipeline Layout
+    VkPipelineLayout layout = device.GetLayoutCache().GetPipelineLayout(layoutDescs, pushConstantRanges);
 
     // Graphics Pipeline
     VkGraphicsPipelineCreateInfo pipelineInfo{};
     pipelineInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.pNext               = renderPass ? nullptr : &renderingInfo;
     pipelineInfo.stageCount          = 2;
     pipelineInfo.pStages             = shaderStages;
     pipelineInfo.pVertexInputState   = &vertexInputInfo;
@@ -154,15 +496,16 @@ std::unique_ptr<VulkanPipeline> VulkanPipeline::Create(
     pipelineInfo.pViewportState      = &viewportState;
     pipelineInfo.pRasterizationState = &rasterizer;
     pipelineInfo.pMultisampleState   = &multisampling;
+    pipelineInfo.pDepthStencilState  = &depthStencil;
     pipelineInfo.pColorBlendState    = &colorBlending;
     pipelineInfo.layout              = layout;
-    pipelineInfo.renderPass          = renderPass.GetHandle();
+    pipelineInfo.renderPass          = renderPass ? renderPass->GetHandle() : VK_NULL_HANDLE;
     pipelineInfo.subpass             = 0;
     pipelineInfo.basePipelineHandle  = VK_NULL_HANDLE;
 
     // Create Pipeline
     VkPipeline handle = VK_NULL_HANDLE;
-    result = vkCreateGraphicsPipelines(device.GetHandle(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &handle);
+    result = vkCreateGraphicsPipelines(device.GetHandle(), pipelineCache, 1, &pipelineInfo, nullptr, &handle);
     if (result != VK_SUCCESS)
     {
         std::cerr << "[ERROR]\t'vkCreateGraphicsPipelines' Failed with Error Code " << result << "\n";
@@ -176,9 +519,7 @@ std::unique_ptr<VulkanPipeline> VulkanPipeline::Create(
         new VulkanPipeline(
             device,
             handle,
-            layout,
-            std::move(vertexShaderModule),
-            std::move(pixelShaderModule)
+            layout
         )
     );
 }
@@ -192,12 +533,8 @@ void VulkanPipeline::Cleanup()
         m_handle = VK_NULL_HANDLE;
     }
 
-    // Destroy Pipeline Layout
-    if (m_layout != VK_NULL_HANDLE)
-    {
-        vkDestroyPipelineLayout(m_device.GetHandle(), m_layout, nullptr);
-        m_layout = VK_NULL_HANDLE;
-    }
+    // Pipeline Layout is Owned by the Layout Cache
+    m_layout = VK_NULL_HANDLE;
 }
 
 void VulkanPipeline::Bind(
@@ -224,44 +561,68 @@ void VulkanPipeline::Bind(
 
 uint32_t VulkanPipeline::BeginFrame(
     const VulkanSwapchain  &swapchain,
-    const VulkanRenderPass &renderPass,
+    const VulkanRenderPass *renderPass,
     const VulkanSync       &sync,
     VkCommandBuffer vkCommandBuffer,
     uint32_t        currentFrame
 ) {
     VkResult result = VK_SUCCESS;
 
-    VkSemaphore imageAvailableSemaphore = sync.GetImageSemaphores()[currentFrame]->GetHandle();
-
     uint32_t imageIndex;
-    result = vkAcquireNextImageKHR(m_device.GetHandle(), swapchain.GetHandle(), UINT64_MAX, imageAvailableSemaphore, VK_NULL_HANDLE, &imageIndex);
-    if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
+    if (swapchain.IsHeadless())
+    {
+        imageIndex = swapchain.AcquireHeadlessImage(currentFrame);
+    }
+    else
     {
-        std::cerr << "[ERROR]\t'vkAcquireNextImageKHR' Failed with Error Code " << result << "\n";
+        VkSemaphore imageAvailableSemaphore = sync.GetImageSemaphores()[currentFrame]->GetHandle();
 
-        throw std::runtime_error("Failed to Acquire Swapchain Image.");
+        PROFILE_ZONE("AcquireNextImage");
+        result = vkAcquireNextImageKHR(m_device.GetHandle(), swapchain.GetHandle(), UINT64_MAX, imageAvailableSemaphore, VK_NULL_HANDLE, &imageIndex);
+        if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
+        {
+            std::cerr << "[ERROR]\t'vkAcquireNextImageKHR' Failed with Error Code " << result << "\n";
+
+            throw std::runtime_error("Failed to Acquire Swapchain Image.");
+        }
     }
 
+    // Attachments are Bound by the Render Graph when Rendering Dynamically
+    if (!renderPass)
+        return imageIndex;
+
     // Begin Render Pass
     VkRenderPassBeginInfo renderPassInfo{};
     renderPassInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    renderPassInfo.renderPass        = renderPass.GetHandle();
+    renderPassInfo.renderPass        = renderPass->GetHandle();
     renderPassInfo.framebuffer       = swapchain.GetFramebuffers()[imageIndex]->GetHandle();
     renderPassInfo.renderArea.offset = {0, 0};
     renderPassInfo.renderArea.extent = swapchain.GetExtent();
 
-    VkClearValue clearColor = {{{0.0f, 0.0f, 0.0f, 1.0f}}};
-    renderPassInfo.clearValueCount = 1;
-    renderPassInfo.pClearValues    = &clearColor;
+    // Reverse-Z Clears Depth to the Far Plane at 0
+    std::array<VkClearValue, 2> clearValues{};
+    clearValues[0].color        = {{0.0f, 0.0f, 0.0f, 1.0f}};
+    clearValues[1].depthStencil = {0.0f, 0};
+
+    renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
+    renderPassInfo.pClearValues    = clearValues.data();
 
     vkCmdBeginRenderPass(vkCommandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
 
     return imageIndex;
 }
 
+void VulkanPipeline::EndRenderPass(
+    const VulkanRenderPass *renderPass,
+    VkCommandBuffer vkCommandBuffer
+) {
+    if (renderPass)
+        vkCmdEndRenderPass(vkCommandBuffer);
+}
+
 void VulkanPipeline::EndFrame(
-    const VulkanSwapchain &swapchain,
-    const VulkanSync      &sync,
+    const VulkanSwapchain  &swapchain,
+    VulkanSync             &sync,
     VkCommandBuffer vkCommandBuffer,
     uint32_t        currentFrame,
     uint32_t        imageIndex
@@ -270,8 +631,6 @@ void VulkanPipeline::EndFrame(
 
     VkResult result = VK_SUCCESS;
 
-    vkCmdEndRenderPass(vkCommandBuffer);
-
     result = vkEndCommandBuffer(vkCommandBuffer);
     if (result != VK_SUCCESS)
     {
@@ -283,23 +642,29 @@ void VulkanPipeline::EndFrame(
     VkSemaphore imageAvailableSemaphore = sync.GetImageSemaphores()[currentFrame]->GetHandle();
     VkSemaphore renderFinishedSemaphore = sync.GetRenderSemaphores()[currentFrame]->GetHandle();
 
+    // Headless Frames have No Acquire to Wait On and No Present to Signal
+    bool headless = swapchain.IsHeadless();
+
     // Submit
     VkSubmitInfo submitInfo{};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
-    std::vector<VkSemaphore> waitSemaphores   = { imageAvailableSemaphore };
-    std::vector<VkSemaphore> signalSemaphores = { renderFinishedSemaphore };
-    std::vector<VkPipelineStageFlags> waitStages = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    
-    submitInfo.waitSemaphoreCount   = static_cast<uint32_t>(waitSemaphores.size());
-    submitInfo.pWaitSemaphores      = waitSemaphores.data();
-    submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
-    submitInfo.pSignalSemaphores    = signalSemaphores.data();
-    submitInfo.pWaitDstStageMask    = waitStages.data();
+    // The Acquire and any Uploads to this Frame's Buffers, in Arrays the Sync Object Reuses
+    if (!headless)
+        sync.AddFrameWait(currentFrame, imageAvailableSemaphore, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+
+    submitInfo.waitSemaphoreCount   = sync.GetFrameWaitCount(currentFrame);
+    submitInfo.pWaitSemaphores      = sync.GetFrameWaitSemaphores(currentFrame);
+    submitInfo.pWaitDstStageMask    = sync.GetFrameWaitStages(currentFrame);
+    submitInfo.signalSemaphoreCount = headless ? 0 : 1;
+    submitInfo.pSignalSemaphores    = &renderFinishedSemaphore;
     submitInfo.commandBufferCount   = 1;
     submitInfo.pCommandBuffers      = &vkCommandBuffer;
 
-    result = vkQueueSubmit(m_device.GetGraphicsQueue(), 1, &submitInfo, sync.GetInFlightFences()[currentFrame]->GetHandle());
+    {
+        PROFILE_ZONE("QueueSubmit");
+        result = vkQueueSubmit(m_device.GetGraphicsQueue(), 1, &submitInfo, sync.GetInFlightFences()[currentFrame]->GetHandle());
+    }
     if (result != VK_SUCCESS)
     {
         std::cerr << "[ERROR]\t'vkQueueSubmit' Failed with Error Code " << result << "\n";
@@ -307,26 +672,29 @@ void VulkanPipeline::EndFrame(
         throw std::runtime_error("Failed to Submit Draw Command Buffer.");
     }
 
+    sync.MarkFrameSubmitted(currentFrame);
+
+    if (headless)
+        return;
+
     // Present
     VkPresentInfoKHR presentInfo{};
     presentInfo.sType              = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
-    presentInfo.waitSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
-    presentInfo.pWaitSemaphores    = signalSemaphores.data();
+    presentInfo.waitSemaphoreCount = 1;
+    presentInfo.pWaitSemaphores    = &renderFinishedSemaphore;
 
-    std::vector<VkSwapchainKHR> swapchains = { swapchainHandle };
-    presentInfo.swapchainCount  = static_cast<uint32_t>(swapchains.size());
-    presentInfo.pSwapchains     = swapchains.data();
+    presentInfo.swapchainCount  = 1;
+    presentInfo.pSwapchains     = &swapchainHandle;
     presentInfo.pImageIndices   = &imageIndex;
 
+    PROFILE_ZONE("QueuePresent");
     vkQueuePresentKHR(m_device.GetPresentQueue(), &presentInfo);
 }
 
 VulkanPipeline::VulkanPipeline(VulkanPipeline &&other) noexcept : 
     m_device(other.m_device),
     m_handle(other.m_handle),
-    m_layout(other.m_layout),
-    m_vertexShaderModule(std::move(other.m_vertexShaderModule)),
-    m_pixelShaderModule(std::move(other.m_pixelShaderModule))
+    m_layout(other.m_layout)
 {
     other.m_handle = VK_NULL_HANDLE;
     other.m_layout = VK_NULL_HANDLE;
@@ -340,8 +708,6 @@ VulkanPipeline& VulkanPipeline::operator=(VulkanPipeline &&other) noexcept
 
         m_handle = other.m_handle;
         m_layout = other.m_layout;
-        m_vertexShaderModule = std::move(other.m_vertexShaderModule);
-        m_pixelShaderModule  = std::move(other.m_pixelShaderModule);
 
         other.m_handle = VK_NULL_HANDLE;
         other.m_layout = VK_NULL_HANDLE;
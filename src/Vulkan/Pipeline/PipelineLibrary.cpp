@@ -0,0 +1,297 @@
+#include "Vulkan/Pipeline/PipelineLibrary.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "Utils.hpp"
+
+#include "Vulkan/Core/Device.hpp"
+#include "Vulkan/Pipeline/ShaderModuleCache.hpp"
+#include "Vulkan/Pipeline/ShaderWatcher.hpp"
+
+// How Long the Watcher Thread Blocks Before Checking for Shutdown
+constexpr std::chrono::milliseconds SHADER_WATCH_INTERVAL(250);
+
+static std::string NormalizePath(const std::string &path)
+{
+    return std::filesystem::path(path).lexically_normal().generic_string();
+}
+
+VulkanPipelineLibrary::VulkanPipelineLibrary(
+    const VulkanDevice     &device,
+    const VulkanSwapchain  &swapchain,
+    const VulkanRenderPass *renderPass,
+    VkPipelineCache pipelineCache,
+    std::string     pipelineCachePath,
+    std::unique_ptr<ShaderWatcher> watcher,
+    uint32_t frameCount
+) : m_device(device),
+    m_swapchain(swapchain),
+    m_renderPass(renderPass),
+    m_frameCount(frameCount),
+    m_pipelineCache(pipelineCache),
+    m_pipelineCachePath(std::move(pipelineCachePath)),
+    m_watcher(std::move(watcher))
+{
+    if (m_watcher)
+    {
+        m_running = true;
+        m_thread  = std::thread(&VulkanPipelineLibrary::WatchShaders, this);
+    }
+}
+
+VulkanPipelineLibrary::~VulkanPipelineLibrary()
+{
+    Cleanup();
+}
+
+std::unique_ptr<VulkanPipelineLibrary> VulkanPipelineLibrary::Create(
+    const VulkanDevice     &device,
+    const VulkanSwapchain  &swapchain,
+    const VulkanRenderPass *renderPass,
+    const std::string      &shaderDirectory,
+    const std::string      &pipelineCachePath,
+    bool     hotReload,
+    uint32_t frameCount
+) {
+    VkResult result = VK_SUCCESS;
+
+    // Previous Run's Cache, Incompatible Data is Ignored by the Driver
+    std::vector<char> cacheData;
+    if (std::filesystem::exists(pipelineCachePath))
+        cacheData = readFileBinary(pipelineCachePath);
+
+    VkPipelineCacheCreateInfo cacheInfo{};
+    cacheInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cacheInfo.initialDataSize = cacheData.size();
+    cacheInfo.pInitialData    = cacheData.data();
+
+    // Create Pipeline Cache
+    VkPipelineCache pipelineCache = VK_NULL_HANDLE;
+    result = vkCreatePipelineCache(device.GetHandle(), &cacheInfo, nullptr, &pipelineCache);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "[ERROR]\t'vkCreatePipelineCache' Failed with Error Code " << result << "\n";
+
+        throw std::runtime_error("Failed to Create Pipeline Cache.");
+    }
+
+    std::cout << "[INFO]\tPipeline Cache Created Successfully (" << cacheData.size() << " Bytes Loaded).\n";
+
+    std::unique_ptr<ShaderWatcher> watcher;
+    if (hotReload)
+        watcher = ShaderWatcher::Create(shaderDirectory);
+
+    return std::unique_ptr<VulkanPipelineLibrary>(
+        new VulkanPipelineLibrary(
+            device,
+            swapchain,
+            renderPass,
+            pipelineCache,
+            pipelineCachePath,
+            std::move(watcher),
+            frameCount
+        )
+    );
+}
+
+VulkanPipelineHandle VulkanPipelineLibrary::Add(const VulkanPipelineDesc &desc)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_handles.find(desc);
+        if (it != m_handles.end())
+            return it->second;
+    }
+
+    auto pipeline = VulkanPipeline::Create(
+        m_device,
+        m_swapchain,
+        m_renderPass,
+        desc,
+        m_frameCount,
+        m_pipelineCache
+    );
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Another Thread Built the Same Desc Meanwhile, Keep Theirs and Drop Ours Unused
+    auto it = m_handles.find(desc);
+    if (it != m_handles.end())
+        return it->second;
+
+    auto handle = static_cast<VulkanPipelineHandle>(m_entries.size());
+
+    m_entries.push_back({ desc, std::move(pipeline) });
+    m_handles.emplace(desc, handle);
+
+    return handle;
+}
+
+void VulkanPipelineLibrary::Update(uint64_t frameNumber)
+{
+    // Destroy Pipelines no Frame in Flight can Reference
+    auto retired = std::remove_if(
+        m_retiredPipelines.begin(),
+        m_retiredPipelines.end(),
+        [this, frameNumber](const RetiredPipeline &pipeline) {
+            return frameNumber >= pipeline.frameNumber + m_frameCount;
+        }
+    );
+    m_retiredPipelines.erase(retired, m_retiredPipelines.end());
+
+    // Never Stall the Frame on the Rebuild Thread
+    std::unique_lock<std::mutex> lock(m_mutex, std::try_to_lock);
+    if (!lock.owns_lock() || m_pendingSwaps.empty())
+        return;
+
+    for (auto &swap : m_pendingSwaps)
+    {
+        Entry &entry = m_entries[swap.handle];
+
+        m_retiredPipelines.push_back({ frameNumber, std::move(entry.pipeline) });
+        entry.pipeline = std::move(swap.pipeline);
+
+        std::cout << "[INFO]\tGraphics Pipeline " << swap.handle << " Reloaded.\n";
+    }
+    m_pendingSwaps.clear();
+}
+
+VulkanPipeline& VulkanPipelineLibrary::Get(VulkanPipelineHandle handle) const
+{
+    if (handle >= m_entries.size())
+        throw std::runtime_error("Invalid Pipeline Handle.");
+
+    return *m_entries[handle].pipeline;
+}
+
+VulkanPipelineDesc VulkanPipelineLibrary::GetDesc(VulkanPipelineHandle handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (handle >= m_entries.size())
+        throw std::runtime_error("Invalid Pipeline Handle.");
+
+    return m_entries[handle].desc;
+}
+
+void VulkanPipelineLibrary::WatchShaders()
+{
+    while (m_running)
+    {
+        std::vector<std::string> changes = m_watcher->WaitForChanges(SHADER_WATCH_INTERVAL);
+        if (changes.empty())
+            continue;
+
+        // Collect Pipelines Using a Changed Shader
+        std::vector<std::pair<VulkanPipelineHandle, VulkanPipelineDesc>> affected;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            for (size_t i = 0; i < m_entries.size(); ++i)
+            {
+                const VulkanPipelineDesc &desc = m_entries[i].desc;
+
+                bool isAffected = std::any_of(
+                    changes.begin(),
+                    changes.end(),
+                    [&desc](const std::string &path) {
+                        return path == NormalizePath(desc.vertexShaderPath) ||
+                               path == NormalizePath(desc.pixelShaderPath);
+                    }
+                );
+
+                if (isAffected)
+                    affected.emplace_back(static_cast<VulkanPipelineHandle>(i), desc);
+            }
+        }
+
+        // Rebuild Outside the Lock, Keeping the Old Pipeline on Failure
+        for (auto &[handle, desc] : affected)
+        {
+            try
+            {
+                auto pipeline = VulkanPipeline::Create(
+                    m_device,
+                    m_swapchain,
+                    m_renderPass,
+                    desc,
+                    m_frameCount,
+                    m_pipelineCache
+                );
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                // A Newer Rebuild Replaces One not yet Swapped In
+                auto it = std::find_if(
+                    m_pendingSwaps.begin(),
+                    m_pendingSwaps.end(),
+                    [handle](const PendingSwap &swap) { return swap.handle == handle; }
+                );
+
+                if (it != m_pendingSwaps.end())
+                    it->pipeline = std::move(pipeline);
+                else
+                    m_pendingSwaps.push_back({ handle, std::move(pipeline) });
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "[ERROR]\tShader Reload Failed: " << e.what() << "\n";
+            }
+        }
+
+        Trim();
+    }
+}
+
+void VulkanPipelineLibrary::Trim()
+{
+    m_device.GetShaderModuleCache().Trim();
+}
+
+void VulkanPipelineLibrary::SavePipelineCache()
+{
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(m_device.GetHandle(), m_pipelineCache, &dataSize, nullptr) != VK_SUCCESS)
+        return;
+
+    std::vector<char> data(dataSize);
+    if (vkGetPipelineCacheData(m_device.GetHandle(), m_pipelineCache, &dataSize, data.data()) != VK_SUCCESS)
+        return;
+
+    std::ofstream file(m_pipelineCachePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "[ERROR]\tCould not Write Pipeline Cache '" << m_pipelineCachePath << "'.\n";
+        return;
+    }
+
+    file.write(data.data(), static_cast<std::streamsize>(dataSize));
+}
+
+void VulkanPipelineLibrary::Cleanup()
+{
+    // Stop Watcher Thread
+    m_running = false;
+    if (m_thread.joinable())
+        m_thread.join();
+
+    m_pendingSwaps.clear();
+    m_retiredPipelines.clear();
+    m_handles.clear();
+    m_entries.clear();
+
+    // Destroy Pipeline Cache
+    if (m_pipelineCache != VK_NULL_HANDLE)
+    {
+        SavePipelineCache();
+
+        vkDestroyPipelineCache(m_device.GetHandle(), m_pipelineCache, nullptr);
+        m_pipelineCache = VK_NULL_HANDLE;
+    }
+}
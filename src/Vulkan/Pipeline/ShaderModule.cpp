@@ -1,5 +1,6 @@
 #include "Vulkan/Pipeline/ShaderModule.hpp"
 
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 
@@ -9,9 +10,13 @@
 
 VulkanShaderModule::VulkanShaderModule(
     const VulkanDevice &device,
-    VkShaderModule m_handle
+    VkShaderModule m_handle,
+    std::vector<uint32_t>  code,
+    VulkanShaderReflection reflection
 ) : m_device(device),
-    m_handle(m_handle)
+    m_handle(m_handle),
+    m_code(std::move(code)),
+    m_reflection(std::move(reflection))
 {}
 
 VulkanShaderModule::~VulkanShaderModule()
@@ -21,38 +26,69 @@ VulkanShaderModule::~VulkanShaderModule()
 
 std::unique_ptr<VulkanShaderModule> VulkanShaderModule::Create(
     const VulkanDevice &device,
-    const std::string &filePath
+    std::vector<uint32_t> code,
+    bool createHandle
 ) {
     VkResult result = VK_SUCCESS;
 
-    std::vector<char> code = readFileBinary(filePath);
+    // Reflect Shader Interface
+    VulkanShaderReflection reflection = VulkanShaderReflection::Reflect(code.data(), code.size());
 
-    // Shader Module Create Info
-    VkShaderModuleCreateInfo createInfo{};
-    createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    createInfo.codeSize = code.size();
-    createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
-
-    // Create Shader Module
     VkShaderModule handle = VK_NULL_HANDLE;
-    result = vkCreateShaderModule(device.GetHandle(), &createInfo, nullptr, &handle);
-    if (result != VK_SUCCESS)
+    if (createHandle)
     {
-        std::cerr << "[ERROR]\t'vkCreateShaderModule' Failed with Error Code " << result << "\n";
-
-        throw std::runtime_error("Failed to Create Shader Module.");
+        // Shader Module Create Info
+        VkShaderModuleCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        createInfo.codeSize = code.size() * sizeof(uint32_t);
+        createInfo.pCode = code.data();
+
+        // Create Shader Module
+        result = vkCreateShaderModule(device.GetHandle(), &createInfo, nullptr, &handle);
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "[ERROR]\t'vkCreateShaderModule' Failed with Error Code " << result << "\n";
+
+            throw std::runtime_error("Failed to Create Shader Module.");
+        }
+
+        std::cout << "[INFO]\tShader Module Created Successfully.\n";
     }
 
-    std::cout << "[INFO]\tShader Module Created Successfully.\n";
-
     return std::unique_ptr<VulkanShaderModule>(
         new VulkanShaderModule(
             device,
-            handle
+            handle,
+            std::move(code),
+            std::move(reflection)
         )
     );
 }
 
+std::vector<uint32_t> VulkanShaderModule::ReadCode(const std::string &filePath)
+{
+    std::vector<char> bytes = readFileBinary(filePath);
+
+    if (bytes.empty() || bytes.size() % sizeof(uint32_t) != 0)
+        throw std::runtime_error("Shader File '" + filePath + "' is not Valid SPIR-V.");
+
+    // Copy into Words to Guarantee Alignment
+    std::vector<uint32_t> code(bytes.size() / sizeof(uint32_t));
+    std::memcpy(code.data(), bytes.data(), bytes.size());
+
+    return code;
+}
+
+VkShaderModuleCreateInfo VulkanShaderModule::GetCreateInfo() const
+{
+    VkShaderModuleCreateInfo createInfo{};
+    createInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    createInfo.codeSize = m_code.size() * sizeof(uint32_t);
+    createInfo.pCode    = m_code.data();
+
+    return createInfo;
+}
+
 void VulkanShaderModule::Cleanup()
 {
     if (m_handle != VK_NULL_HANDLE)
@@ -64,7 +100,9 @@ void VulkanShaderModule::Cleanup()
 
 VulkanShaderModule::VulkanShaderModule(VulkanShaderModule &&other) noexcept : 
     m_device(other.m_device),
-    m_handle(other.m_handle)
+    m_handle(other.m_handle),
+    m_code(std::move(other.m_code)),
+    m_reflection(std::move(other.m_reflection))
 {
     other.m_handle = VK_NULL_HANDLE;
 }
@@ -75,7 +113,9 @@ VulkanShaderModule& VulkanShaderModule::operator=(VulkanShaderModule &&other) no
     {
         Cleanup();
 
-        m_handle = other.m_handle;
+        m_handle     = other.m_handle;
+        m_code       = std::move(other.m_code);
+        m_reflection = std::move(other.m_reflection);
 
         other.m_handle = VK_NULL_HANDLE;
     }
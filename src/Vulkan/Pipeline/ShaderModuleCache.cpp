@@ -0,0 +1,99 @@
+#include "Vulkan/Pipeline/ShaderModuleCache.hpp"
+
+#include <iostream>
+
+#include "Utils.hpp"
+
+#include "Vulkan/Pipeline/ShaderModule.hpp"
+
+VulkanShaderModuleCache::VulkanShaderModuleCache(
+    const VulkanDevice &device,
+    bool inlineCode
+) : m_device(device),
+    m_inlineCode(inlineCode)
+{}
+
+VulkanShaderModuleCache::~VulkanShaderModuleCache() = default;
+
+std::unique_ptr<VulkanShaderModuleCache> VulkanShaderModuleCache::Create(
+    const VulkanDevice &device,
+    bool inlineCode
+) {
+    return std::unique_ptr<VulkanShaderModuleCache>(
+        new VulkanShaderModuleCache(device, inlineCode)
+    );
+}
+
+std::shared_ptr<const VulkanShaderModule> VulkanShaderModuleCache::Load(const std::string &filePath)
+{
+    std::string path = std::filesystem::path(filePath).lexically_normal().generic_string();
+
+    std::error_code error;
+    auto timestamp = std::filesystem::last_write_time(path, error);
+    auto size      = std::filesystem::file_size(path, error);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Unchanged File with a Live Module
+    auto file = m_files.find(path);
+    if (!error && file != m_files.end() && file->second.timestamp == timestamp && file->second.size == size)
+    {
+        auto it = FindModule(file->second.hash, file->second.module);
+        if (it != m_modules.end())
+            return it->second;
+    }
+
+    std::vector<uint32_t> code = VulkanShaderModule::ReadCode(path);
+    uint64_t hash = hashBytes(code.data(), code.size() * sizeof(uint32_t));
+
+    // Identical Code from Another Path, a Hash Match with Different Code is a Collision
+    auto [first, last] = m_modules.equal_range(hash);
+    for (auto it = first; it != last; ++it)
+    {
+        if (it->second->GetCode() != code)
+            continue;
+
+        m_files[path] = { timestamp, size, hash, it->second.get() };
+        return it->second;
+    }
+
+    std::shared_ptr<const VulkanShaderModule> module = VulkanShaderModule::Create(
+        m_device,
+        std::move(code),
+        !m_inlineCode
+    );
+
+    m_modules.emplace(hash, module);
+    m_files[path] = { timestamp, size, hash, module.get() };
+
+    return module;
+}
+
+std::unordered_multimap<uint64_t, std::shared_ptr<const VulkanShaderModule>>::iterator VulkanShaderModuleCache::FindModule(
+    uint64_t hash,
+    const VulkanShaderModule *module
+) {
+    auto [first, last] = m_modules.equal_range(hash);
+    for (auto it = first; it != last; ++it)
+    {
+        if (it->second.get() == module)
+            return it;
+    }
+
+    return m_modules.end();
+}
+
+void VulkanShaderModuleCache::Trim()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Pipelines do not Reference Modules after Creation
+    std::erase_if(
+        m_modules,
+        [](const auto &entry) { return entry.second.use_count() == 1; }
+    );
+    std::erase_if(
+        m_files,
+        [this](const auto &entry) { return FindModule(entry.second.hash, entry.second.module) == m_modules.end(); }
+    );
+}
@@ -0,0 +1,540 @@
+#include "Vulkan/Pipeline/ShaderReflection.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+// SPIR-V Constants
+constexpr uint32_t SPIRV_MAGIC = 0x07230203;
+
+enum SpirvOp : uint32_t
+{
+    SpirvOpName                 = 5,
+    SpirvOpEntryPoint           = 15,
+    SpirvOpExecutionMode        = 16,
+    SpirvOpTypeBool             = 20,
+    SpirvOpTypeInt              = 21,
+    SpirvOpTypeFloat            = 22,
+    SpirvOpTypeVector           = 23,
+    SpirvOpTypeMatrix           = 24,
+    SpirvOpTypeImage            = 25,
+    SpirvOpTypeSampler          = 26,
+    SpirvOpTypeSampledImage     = 27,
+    SpirvOpTypeArray            = 28,
+    SpirvOpTypeRuntimeArray     = 29,
+    SpirvOpTypeStruct           = 30,
+    SpirvOpTypePointer          = 32,
+    SpirvOpConstant             = 43,
+    SpirvOpSpecConstantTrue     = 48,
+    SpirvOpSpecConstantFalse    = 49,
+    SpirvOpSpecConstant         = 50,
+    SpirvOpVariable             = 59,
+    SpirvOpDecorate             = 71,
+    SpirvOpMemberDecorate       = 72,
+    SpirvOpExecutionModeId      = 331,
+    SpirvOpTypeAccelerationStructure = 5341
+};
+
+enum SpirvDecoration : uint32_t
+{
+    SpirvDecorationSpecId        = 1,
+    SpirvDecorationBlock         = 2,
+    SpirvDecorationBufferBlock   = 3,
+    SpirvDecorationArrayStride   = 6,
+    SpirvDecorationMatrixStride  = 7,
+    SpirvDecorationBuiltIn       = 11,
+    SpirvDecorationLocation      = 30,
+    SpirvDecorationBinding       = 33,
+    SpirvDecorationDescriptorSet = 34,
+    SpirvDecorationOffset        = 35
+};
+
+enum SpirvStorageClass : uint32_t
+{
+    SpirvStorageClassUniformConstant = 0,
+    SpirvStorageClassInput           = 1,
+    SpirvStorageClassUniform         = 2,
+    SpirvStorageClassPushConstant    = 9,
+    SpirvStorageClassStorageBuffer   = 12
+};
+
+constexpr uint32_t SPIRV_EXECUTION_MODE_LOCAL_SIZE    = 17;
+constexpr uint32_t SPIRV_EXECUTION_MODE_LOCAL_SIZE_ID = 38;
+
+constexpr uint32_t SPIRV_DIM_BUFFER       = 5;
+constexpr uint32_t SPIRV_DIM_SUBPASS_DATA = 6;
+
+constexpr uint32_t SPIRV_UNSET = UINT32_MAX;
+
+// Parsed Module State
+struct SpirvId
+{
+    uint32_t opcode = 0;
+
+    // Types
+    std::vector<uint32_t> operands;
+
+    // Constants
+    uint32_t constantValue = 0;
+
+    // Variables
+    uint32_t typeId       = 0;
+    uint32_t storageClass = 0;
+
+    // Decorations
+    uint32_t specId       = SPIRV_UNSET;
+    uint32_t location     = SPIRV_UNSET;
+    uint32_t binding      = SPIRV_UNSET;
+    uint32_t set          = SPIRV_UNSET;
+    uint32_t arrayStride  = 0;
+    bool     isBuiltIn    = false;
+    bool     isBlock      = false;
+    bool     isBufferBlock = false;
+
+    std::vector<uint32_t> memberOffsets;
+    std::vector<uint32_t> memberMatrixStrides;
+
+    std::string name;
+};
+
+static std::string ReadString(const uint32_t *words, uint32_t wordCount, uint32_t &consumed)
+{
+    const char *chars = reinterpret_cast<const char*>(words);
+    size_t      limit = static_cast<size_t>(wordCount) * sizeof(uint32_t);
+    size_t      length = 0;
+
+    while (length < limit && chars[length] != '\0')
+        ++length;
+
+    consumed = static_cast<uint32_t>(length / sizeof(uint32_t) + 1);
+
+    return std::string(chars, length);
+}
+
+static VkShaderStageFlagBits GetStage(uint32_t executionModel)
+{
+    switch (executionModel)
+    {
+        case 0: return VK_SHADER_STAGE_VERTEX_BIT;
+        case 1: return VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+        case 2: return VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+        case 3: return VK_SHADER_STAGE_GEOMETRY_BIT;
+        case 4: return VK_SHADER_STAGE_FRAGMENT_BIT;
+        case 5: return VK_SHADER_STAGE_COMPUTE_BIT;
+        default:
+            throw std::runtime_error("SPIR-V Entry Point uses an Unsupported Execution Model.");
+    }
+}
+
+static uint32_t GetTypeSize(const std::unordered_map<uint32_t, SpirvId> &ids, uint32_t typeId)
+{
+    const SpirvId &type = ids.at(typeId);
+
+    switch (type.opcode)
+    {
+        case SpirvOpTypeBool:
+            return 4;
+        case SpirvOpTypeInt:
+        case SpirvOpTypeFloat:
+            return type.operands[0] / 8;
+        case SpirvOpTypeVector:
+            return GetTypeSize(ids, type.operands[0]) * type.operands[1];
+        case SpirvOpTypeMatrix:
+            return GetTypeSize(ids, type.operands[0]) * type.operands[1];
+        case SpirvOpTypeArray:
+        {
+            uint32_t length = ids.at(type.operands[1]).constantValue;
+            uint32_t stride = type.arrayStride != 0 ? type.arrayStride : GetTypeSize(ids, type.operands[0]);
+
+            return stride * length;
+        }
+        case SpirvOpTypeStruct:
+        {
+            uint32_t size = 0;
+            for (size_t i = 0; i < type.operands.size(); ++i)
+            {
+                uint32_t offset = i < type.memberOffsets.size() && type.memberOffsets[i] != SPIRV_UNSET
+                    ? type.memberOffsets[i]
+                    : size;
+
+                uint32_t memberSize = GetTypeSize(ids, type.operands[i]);
+
+                // Row or Column Major Matrices Honour the Declared Stride
+                const SpirvId &member = ids.at(type.operands[i]);
+                if (member.opcode == SpirvOpTypeMatrix &&
+                    i < type.memberMatrixStrides.size() && type.memberMatrixStrides[i] != 0)
+                    memberSize = type.memberMatrixStrides[i] * member.operands[1];
+
+                size = std::max(size, offset + memberSize);
+            }
+            return size;
+        }
+        default:
+            return 0;
+    }
+}
+
+static VkFormat GetInputFormat(const std::unordered_map<uint32_t, SpirvId> &ids, uint32_t typeId)
+{
+    const SpirvId &type = ids.at(typeId);
+
+    uint32_t componentCount  = 1;
+    uint32_t componentTypeId = typeId;
+
+    if (type.opcode == SpirvOpTypeVector)
+    {
+        componentTypeId = type.operands[0];
+        componentCount  = type.operands[1];
+    }
+
+    const SpirvId &component = ids.at(componentTypeId);
+    uint32_t width = component.operands.empty() ? 0 : component.operands[0];
+
+    if (component.opcode == SpirvOpTypeFloat && width == 32)
+    {
+        static const VkFormat formats[] = {
+            VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT, VK_FORMAT_R32G32B32_SFLOAT, VK_FORMAT_R32G32B32A32_SFLOAT
+        };
+        return formats[componentCount - 1];
+    }
+    if (component.opcode == SpirvOpTypeFloat && width == 16)
+    {
+        static const VkFormat formats[] = {
+            VK_FORMAT_R16_SFLOAT, VK_FORMAT_R16G16_SFLOAT, VK_FORMAT_R16G16B16_SFLOAT, VK_FORMAT_R16G16B16A16_SFLOAT
+        };
+        return formats[componentCount - 1];
+    }
+    if (component.opcode == SpirvOpTypeInt && width == 32)
+    {
+        bool isSigned = component.operands[1] != 0;
+
+        static const VkFormat signedFormats[] = {
+            VK_FORMAT_R32_SINT, VK_FORMAT_R32G32_SINT, VK_FORMAT_R32G32B32_SINT, VK_FORMAT_R32G32B32A32_SINT
+        };
+        static const VkFormat unsignedFormats[] = {
+            VK_FORMAT_R32_UINT, VK_FORMAT_R32G32_UINT, VK_FORMAT_R32G32B32_UINT, VK_FORMAT_R32G32B32A32_UINT
+        };
+        return isSigned ? signedFormats[componentCount - 1] : unsignedFormats[componentCount - 1];
+    }
+
+    return VK_FORMAT_UNDEFINED;
+}
+
+static VkDescriptorType GetDescriptorType(
+    const std::unordered_map<uint32_t, SpirvId> &ids,
+    uint32_t storageClass,
+    uint32_t typeId
+) {
+    const SpirvId &type = ids.at(typeId);
+
+    if (storageClass == SpirvStorageClassStorageBuffer)
+        return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+
+    if (storageClass == SpirvStorageClassUniform)
+        return type.isBufferBlock ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+
+    switch (type.opcode)
+    {
+        case SpirvOpTypeSampler:
+            return VK_DESCRIPTOR_TYPE_SAMPLER;
+        case SpirvOpTypeSampledImage:
+            return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        case SpirvOpTypeAccelerationStructure:
+            return VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+        case SpirvOpTypeImage:
+        {
+            uint32_t dim     = type.operands[1];
+            uint32_t sampled = type.operands[5];
+
+            if (dim == SPIRV_DIM_SUBPASS_DATA)
+                return VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+            if (dim == SPIRV_DIM_BUFFER)
+                return sampled == 2 ? VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+
+            return sampled == 2 ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        }
+        default:
+            return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+    }
+}
+
+VulkanShaderReflection VulkanShaderReflection::Reflect(const uint32_t *code, size_t wordCount)
+{
+    if (wordCount < 5 || code[0] != SPIRV_MAGIC)
+        throw std::runtime_error("Shader Code is not Valid SPIR-V.");
+
+    VulkanShaderReflection reflection;
+
+    std::unordered_map<uint32_t, SpirvId> ids;
+    std::vector<uint32_t> variables;
+
+    uint32_t entryPointId = SPIRV_UNSET;
+    std::array<uint32_t, 3> localSizeIds{SPIRV_UNSET, SPIRV_UNSET, SPIRV_UNSET};
+
+    // Parse Instructions
+    size_t offset = 5;
+    while (offset < wordCount)
+    {
+        uint32_t opcode        = code[offset] & 0xFFFF;
+        uint32_t instructionWords = code[offset] >> 16;
+
+        if (instructionWords == 0 || offset + instructionWords > wordCount)
+            throw std::runtime_error("SPIR-V Module is Truncated.");
+
+        const uint32_t *operands     = code + offset + 1;
+        uint32_t        operandCount = instructionWords - 1;
+
+        switch (opcode)
+        {
+            case SpirvOpName:
+            {
+                uint32_t consumed = 0;
+                ids[operands[0]].name = ReadString(operands + 1, operandCount - 1, consumed);
+                break;
+            }
+            case SpirvOpEntryPoint:
+            {
+                // Only the First Entry Point is Reflected
+                if (entryPointId != SPIRV_UNSET)
+                    break;
+
+                uint32_t consumed = 0;
+                reflection.stage      = GetStage(operands[0]);
+                entryPointId          = operands[1];
+                reflection.entryPoint = ReadString(operands + 2, operandCount - 2, consumed);
+                break;
+            }
+            case SpirvOpExecutionMode:
+            case SpirvOpExecutionModeId:
+            {
+                if (operands[0] != entryPointId || operandCount < 5)
+                    break;
+
+                if (opcode == SpirvOpExecutionMode && operands[1] == SPIRV_EXECUTION_MODE_LOCAL_SIZE)
+                    reflection.workgroupSize = { operands[2], operands[3], operands[4] };
+                else if (opcode == SpirvOpExecutionModeId && operands[1] == SPIRV_EXECUTION_MODE_LOCAL_SIZE_ID)
+                    localSizeIds = { operands[2], operands[3], operands[4] };
+                break;
+            }
+            case SpirvOpTypeBool:
+            case SpirvOpTypeInt:
+            case SpirvOpTypeFloat:
+            case SpirvOpTypeVector:
+            case SpirvOpTypeMatrix:
+            case SpirvOpTypeImage:
+            case SpirvOpTypeSampler:
+            case SpirvOpTypeSampledImage:
+            case SpirvOpTypeArray:
+            case SpirvOpTypeRuntimeArray:
+            case SpirvOpTypeStruct:
+            case SpirvOpTypePointer:
+            case SpirvOpTypeAccelerationStructure:
+            {
+                SpirvId &id = ids[operands[0]];
+                id.opcode = opcode;
+                id.operands.assign(operands + 1, operands + operandCount);
+                break;
+            }
+            case SpirvOpConstant:
+            case SpirvOpSpecConstant:
+            {
+                SpirvId &id = ids[operands[1]];
+                id.opcode        = opcode;
+                id.typeId        = operands[0];
+                id.constantValue = operandCount > 2 ? operands[2] : 0;
+                break;
+            }
+            case SpirvOpSpecConstantTrue:
+            case SpirvOpSpecConstantFalse:
+            {
+                SpirvId &id = ids[operands[1]];
+                id.opcode        = opcode;
+                id.typeId        = operands[0];
+                id.constantValue = opcode == SpirvOpSpecConstantTrue ? 1 : 0;
+                break;
+            }
+            case SpirvOpVariable:
+            {
+                SpirvId &id = ids[operands[1]];
+                id.opcode       = opcode;
+                id.typeId       = operands[0];
+                id.storageClass = operands[2];
+
+                variables.push_back(operands[1]);
+                break;
+            }
+            case SpirvOpDecorate:
+            {
+                SpirvId &id = ids[operands[0]];
+                uint32_t literal = operandCount > 2 ? operands[2] : 0;
+
+                switch (operands[1])
+                {
+                    case SpirvDecorationSpecId:        id.specId        = literal; break;
+                    case SpirvDecorationBlock:         id.isBlock       = true;    break;
+                    case SpirvDecorationBufferBlock:   id.isBufferBlock = true;    break;
+                    case SpirvDecorationArrayStride:   id.arrayStride   = literal; break;
+                    case SpirvDecorationBuiltIn:       id.isBuiltIn     = true;    break;
+                    case SpirvDecorationLocation:      id.location      = literal; break;
+                    case SpirvDecorationBinding:       id.binding       = literal; break;
+                    case SpirvDecorationDescriptorSet: id.set           = literal; break;
+                    default: break;
+                }
+                break;
+            }
+            case SpirvOpMemberDecorate:
+            {
+                SpirvId &id = ids[operands[0]];
+                uint32_t member  = operands[1];
+                uint32_t literal = operandCount > 3 ? operands[3] : 0;
+
+                if (operands[2] == SpirvDecorationOffset)
+                {
+                    if (id.memberOffsets.size() <= member)
+                        id.memberOffsets.resize(member + 1, SPIRV_UNSET);
+                    id.memberOffsets[member] = literal;
+                }
+                else if (operands[2] == SpirvDecorationMatrixStride)
+                {
+                    if (id.memberMatrixStrides.size() <= member)
+                        id.memberMatrixStrides.resize(member + 1, 0);
+                    id.memberMatrixStrides[member] = literal;
+                }
+                else if (operands[2] == SpirvDecorationBuiltIn)
+                {
+                    id.isBuiltIn = true;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+
+        offset += instructionWords;
+    }
+
+    if (entryPointId == SPIRV_UNSET)
+        throw std::runtime_error("SPIR-V Module has no Entry Point.");
+
+    for (uint32_t axis = 0; axis < 3; ++axis)
+    {
+        if (localSizeIds[axis] != SPIRV_UNSET)
+            reflection.workgroupSize[axis] = ids.at(localSizeIds[axis]).constantValue;
+    }
+
+    // Reflect Specialization Constants
+    for (const auto &[id, value] : ids)
+    {
+        if (value.specId != SPIRV_UNSET)
+            reflection.specializationConstantIds.push_back(value.specId);
+    }
+
+    // Reflect Variables
+    for (uint32_t variableId : variables)
+    {
+        const SpirvId &variable = ids.at(variableId);
+        const SpirvId &pointer  = ids.at(variable.typeId);
+
+        uint32_t typeId = pointer.operands[1];
+
+        switch (variable.storageClass)
+        {
+            case SpirvStorageClassInput:
+            {
+                // Built-Ins are not Part of the Vertex Input Interface
+                if (variable.isBuiltIn || ids.at(typeId).isBuiltIn)
+                    break;
+
+                if (variable.location == SPIRV_UNSET)
+                    throw std::runtime_error("Shader Input '" + variable.name + "' has no Location.");
+
+                const SpirvId &type = ids.at(typeId);
+
+                // Matrices Occupy One Location per Column
+                uint32_t columnCount  = type.opcode == SpirvOpTypeMatrix ? type.operands[1] : 1;
+                uint32_t columnTypeId = type.opcode == SpirvOpTypeMatrix ? type.operands[0] : typeId;
+
+                for (uint32_t column = 0; column < columnCount; ++column)
+                {
+                    VulkanShaderInput input{};
+                    input.location = variable.location + column;
+                    input.format   = GetInputFormat(ids, columnTypeId);
+                    input.size     = GetTypeSize(ids, columnTypeId);
+                    input.name     = variable.name;
+
+                    if (input.format == VK_FORMAT_UNDEFINED)
+                        throw std::runtime_error("Shader Input '" + variable.name + "' has an Unsupported Type.");
+
+                    reflection.inputs.push_back(std::move(input));
+                }
+                break;
+            }
+            case SpirvStorageClassUniformConstant:
+            case SpirvStorageClassUniform:
+            case SpirvStorageClassStorageBuffer:
+            {
+                VulkanShaderDescriptorBinding binding{};
+                binding.set     = variable.set     == SPIRV_UNSET ? 0 : variable.set;
+                binding.binding = variable.binding == SPIRV_UNSET ? 0 : variable.binding;
+                binding.name    = variable.name;
+
+                // Unwrap Descriptor Arrays
+                const SpirvId *type = &ids.at(typeId);
+                if (type->opcode == SpirvOpTypeArray)
+                {
+                    binding.count = ids.at(type->operands[1]).constantValue;
+                    typeId        = type->operands[0];
+                }
+                else if (type->opcode == SpirvOpTypeRuntimeArray)
+                {
+                    binding.count = 0;
+                    typeId        = type->operands[0];
+                }
+
+                binding.type = GetDescriptorType(ids, variable.storageClass, typeId);
+                if (binding.type == VK_DESCRIPTOR_TYPE_MAX_ENUM)
+                    throw std::runtime_error("Shader Resource '" + variable.name + "' has an Unsupported Descriptor Type.");
+
+                reflection.descriptorBindings.push_back(std::move(binding));
+                break;
+            }
+            case SpirvStorageClassPushConstant:
+            {
+                const SpirvId &type = ids.at(typeId);
+
+                uint32_t rangeOffset = UINT32_MAX;
+                for (uint32_t memberOffset : type.memberOffsets)
+                    rangeOffset = std::min(rangeOffset, memberOffset);
+                if (rangeOffset == UINT32_MAX)
+                    rangeOffset = 0;
+
+                VkPushConstantRange range{};
+                range.stageFlags = reflection.stage;
+                range.offset     = rangeOffset;
+                range.size       = GetTypeSize(ids, typeId) - rangeOffset;
+
+                reflection.pushConstantRanges.push_back(range);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // Sort for Stable Comparison
+    std::sort(reflection.specializationConstantIds.begin(), reflection.specializationConstantIds.end());
+    std::sort(
+        reflection.inputs.begin(),
+        reflection.inputs.end(),
+        [](const VulkanShaderInput &a, const VulkanShaderInput &b) { return a.location < b.location; }
+    );
+    std::sort(
+        reflection.descriptorBindings.begin(),
+        reflection.descriptorBindings.end(),
+        [](const VulkanShaderDescriptorBinding &a, const VulkanShaderDescriptorBinding &b) {
+            return a.set != b.set ? a.set < b.set : a.binding < b.binding;
+        }
+    );
+
+    return reflection;
+}
@@ -0,0 +1,176 @@
+#include "Vulkan/Pipeline/ShaderWatcher.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Coalesce the Multiple Writes a Compiler Makes to One Reload
+constexpr std::chrono::milliseconds SHADER_WATCH_SETTLE_TIME(50);
+
+static bool IsShaderFile(const std::filesystem::path &path)
+{
+    return path.extension() == ".spv";
+}
+
+static std::string NormalizePath(const std::filesystem::path &path)
+{
+    return path.lexically_normal().generic_string();
+}
+
+ShaderWatcher::ShaderWatcher(
+    std::filesystem::path directory,
+    int inotifyHandle,
+    int watchHandle
+) : m_directory(std::move(directory)),
+    m_inotifyHandle(inotifyHandle),
+    m_watchHandle(watchHandle)
+{
+    if (m_inotifyHandle != -1)
+        return;
+
+    // Snapshot Timestamps for Polling
+    std::error_code error;
+    for (const auto &entry : std::filesystem::directory_iterator(m_directory, error))
+    {
+        if (IsShaderFile(entry.path()))
+            m_timestamps[NormalizePath(entry.path())] = entry.last_write_time(error);
+    }
+}
+
+ShaderWatcher::~ShaderWatcher()
+{
+    Cleanup();
+}
+
+std::unique_ptr<ShaderWatcher> ShaderWatcher::Create(const std::string &directory)
+{
+    int inotifyHandle = -1;
+    int watchHandle   = -1;
+
+#ifdef __linux__
+    inotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyHandle != -1)
+    {
+        watchHandle = inotify_add_watch(inotifyHandle, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (watchHandle == -1)
+        {
+            close(inotifyHandle);
+            inotifyHandle = -1;
+        }
+    }
+
+    if (inotifyHandle == -1)
+        std::cerr << "[WARNING]\tinotify Unavailable for '" << directory << "', Polling Instead.\n";
+#endif
+
+    std::cout << "[INFO]\tWatching '" << directory << "' for Shader Changes.\n";
+
+    return std::unique_ptr<ShaderWatcher>(
+        new ShaderWatcher(
+            directory,
+            inotifyHandle,
+            watchHandle
+        )
+    );
+}
+
+std::vector<std::string> ShaderWatcher::WaitForChanges(std::chrono::milliseconds timeout)
+{
+    std::vector<std::string> changes = m_inotifyHandle != -1
+        ? ReadEvents(timeout)
+        : PollTimestamps(timeout);
+
+    std::sort(changes.begin(), changes.end());
+    changes.erase(std::unique(changes.begin(), changes.end()), changes.end());
+
+    return changes;
+}
+
+std::vector<std::string> ShaderWatcher::ReadEvents(std::chrono::milliseconds timeout)
+{
+    std::vector<std::string> changes;
+
+#ifdef __linux__
+    alignas(inotify_event) char buffer[4096];
+
+    pollfd descriptor{ m_inotifyHandle, POLLIN, 0 };
+    int    waitTime = static_cast<int>(timeout.count());
+
+    // Drain Events Until the Directory Settles
+    while (poll(&descriptor, 1, waitTime) > 0)
+    {
+        ssize_t length = 0;
+        while ((length = read(m_inotifyHandle, buffer, sizeof(buffer))) > 0)
+        {
+            for (char *it = buffer; it < buffer + length; )
+            {
+                const inotify_event *event = reinterpret_cast<const inotify_event*>(it);
+
+                if (event->len > 0 && IsShaderFile(event->name))
+                    changes.push_back(NormalizePath(m_directory / event->name));
+
+                it += sizeof(inotify_event) + event->len;
+            }
+        }
+
+        waitTime = static_cast<int>(SHADER_WATCH_SETTLE_TIME.count());
+    }
+#endif
+
+    return changes;
+}
+
+std::vector<std::string> ShaderWatcher::PollTimestamps(std::chrono::milliseconds timeout)
+{
+    std::vector<std::string> changes;
+
+    std::this_thread::sleep_for(timeout);
+
+    std::error_code error;
+    for (const auto &entry : std::filesystem::directory_iterator(m_directory, error))
+    {
+        if (!IsShaderFile(entry.path()))
+            continue;
+
+        auto timestamp = entry.last_write_time(error);
+        if (error)
+            continue;
+
+        std::string path = NormalizePath(entry.path());
+
+        auto it = m_timestamps.find(path);
+        if (it == m_timestamps.end() || it->second != timestamp)
+        {
+            m_timestamps[path] = timestamp;
+            changes.push_back(std::move(path));
+        }
+    }
+
+    // Give the Writer Time to Finish Before Reloading
+    if (!changes.empty())
+        std::this_thread::sleep_for(SHADER_WATCH_SETTLE_TIME);
+
+    return changes;
+}
+
+void ShaderWatcher::Cleanup()
+{
+#ifdef __linux__
+    if (m_inotifyHandle != -1)
+    {
+        if (m_watchHandle != -1)
+            inotify_rm_watch(m_inotifyHandle, m_watchHandle);
+
+        close(m_inotifyHandle);
+
+        m_inotifyHandle = -1;
+        m_watchHandle   = -1;
+    }
+#endif
+}
@@ -0,0 +1,259 @@
+#include "Vulkan/Profiling/GpuProfiler.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+#include "Settings.hpp"
+
+#include "Vulkan/Core/PhysicalDevice.hpp"
+#include "Vulkan/Core/Device.hpp"
+
+#include "Profiling/CpuProfiler.hpp"
+
+VulkanGpuProfiler::VulkanGpuProfiler(
+    const VulkanDevice &device,
+    std::vector<Frame> frames,
+    uint32_t maxScopes,
+    double   timestampPeriod,
+    uint64_t timestampMask
+) : m_device(device),
+    m_frames(std::move(frames)),
+    m_maxScopes(maxScopes),
+    m_timestamps(maxScopes * 2),
+    m_timestampPeriod(timestampPeriod),
+    m_timestampMask(timestampMask)
+{}
+
+VulkanGpuProfiler::~VulkanGpuProfiler()
+{
+    Cleanup();
+}
+
+std::unique_ptr<VulkanGpuProfiler> VulkanGpuProfiler::Create(
+    const VulkanPhysicalDevice &physicalDevice,
+    const VulkanDevice         &device,
+    uint32_t frameCount,
+    uint32_t maxScopes
+) {
+    VkResult result = VK_SUCCESS;
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice.GetHandle(), &properties);
+
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice.GetHandle(), &queueFamilyCount, nullptr);
+
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice.GetHandle(), &queueFamilyCount, queueFamilies.data());
+
+    uint32_t validBits = queueFamilies[device.GetGraphicsQueueFamily()].timestampValidBits;
+    if (validBits == 0 || properties.limits.timestampPeriod == 0.0f)
+    {
+        std::cerr << "[WARNING]\tGraphics Queue does not Support Timestamps, GPU Profiling Disabled.\n";
+        return nullptr;
+    }
+
+    // Two Queries per Scope, One Pool per Frame in Flight
+    std::vector<Frame> frames(frameCount);
+    for (auto &frame : frames)
+    {
+        VkQueryPoolCreateInfo createInfo{};
+        createInfo.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        createInfo.queryType  = VK_QUERY_TYPE_TIMESTAMP;
+        createInfo.queryCount = maxScopes * 2;
+
+        result = vkCreateQueryPool(device.GetHandle(), &createInfo, nullptr, &frame.queryPool);
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "[ERROR]\t'vkCreateQueryPool' Failed with Error Code " << result << "\n";
+
+            for (auto &created : frames)
+            {
+                if (created.queryPool != VK_NULL_HANDLE)
+                    vkDestroyQueryPool(device.GetHandle(), created.queryPool, nullptr);
+            }
+
+            throw std::runtime_error("Failed to Create Timestamp Query Pool.");
+        }
+
+        frame.scopes.reserve(maxScopes);
+    }
+
+    std::cout << "[INFO]\tGPU Profiler Created Successfully.\n";
+
+    return std::unique_ptr<VulkanGpuProfiler>(
+        new VulkanGpuProfiler(
+            device,
+            std::move(frames),
+            maxScopes,
+            static_cast<double>(properties.limits.timestampPeriod),
+            validBits >= 64 ? UINT64_MAX : ((uint64_t(1) << validBits) - 1)
+        )
+    );
+}
+
+void VulkanGpuProfiler::BeginFrame(VkCommandBuffer commandBuffer, uint32_t currentFrame)
+{
+    m_currentFrame = currentFrame;
+
+    Frame &frame = m_frames[currentFrame];
+
+    // Written FRAMES_IN_FLIGHT Frames Ago, its Fence has Signaled so Nothing Waits
+    if (frame.isPending)
+        Collect(frame);
+
+    vkCmdResetQueryPool(commandBuffer, frame.queryPool, 0, m_maxScopes * 2);
+
+    frame.scopes.clear();
+    frame.isPending = true;
+}
+
+uint32_t VulkanGpuProfiler::BeginScope(VkCommandBuffer commandBuffer, const std::string &name)
+{
+    Frame &frame = m_frames[m_currentFrame];
+
+    if (frame.scopes.size() >= m_maxScopes)
+        return UINT32_MAX;
+
+    auto it = m_scopeIndices.find(name);
+    if (it == m_scopeIndices.end())
+    {
+        VulkanGpuScopeStats stats{};
+        stats.name = name;
+        stats.history.reserve(GPU_PROFILER_HISTORY);
+
+        it = m_scopeIndices.emplace(name, static_cast<uint32_t>(m_scopes.size())).first;
+        m_scopes.push_back(std::move(stats));
+        m_traceNames.push_back(CpuProfiler::Intern(name));
+    }
+
+    uint32_t scope = static_cast<uint32_t>(frame.scopes.size());
+    frame.scopes.push_back({ it->second, scope * 2 });
+
+    WriteTimestamp(commandBuffer, frame.queryPool, scope * 2, false);
+
+    return scope;
+}
+
+void VulkanGpuProfiler::EndScope(VkCommandBuffer commandBuffer, uint32_t scope)
+{
+    if (scope == UINT32_MAX)
+        return;
+
+    Frame &frame = m_frames[m_currentFrame];
+    WriteTimestamp(commandBuffer, frame.queryPool, frame.scopes[scope].queryIndex + 1, true);
+}
+
+void VulkanGpuProfiler::MarkSubmitted(uint32_t currentFrame)
+{
+    m_frames[currentFrame].submitTime = CpuProfiler::Now();
+}
+
+void VulkanGpuProfiler::Collect(Frame &frame)
+{
+    frame.isPending = false;
+
+    if (frame.scopes.empty())
+        return;
+
+    // Sized for Every Scope at Creation, Collecting Never Allocates
+    uint64_t *timestamps = m_timestamps.data();
+    uint32_t  queryCount = static_cast<uint32_t>(frame.scopes.size() * 2);
+
+    // No Wait Flag, a Scope that was Never Closed Reports Not Ready and the Frame is Skipped
+    VkResult result = vkGetQueryPoolResults(
+        m_device.GetHandle(),
+        frame.queryPool,
+        0,
+        queryCount,
+        queryCount * sizeof(uint64_t),
+        timestamps,
+        sizeof(uint64_t),
+        VK_QUERY_RESULT_64_BIT
+    );
+    if (result != VK_SUCCESS)
+        return;
+
+    for (const auto &scope : frame.scopes)
+    {
+        uint64_t begin = timestamps[scope.queryIndex]     & m_timestampMask;
+        uint64_t end   = timestamps[scope.queryIndex + 1] & m_timestampMask;
+
+        // Masked Counters Wrap
+        uint64_t ticks = (end - begin) & m_timestampMask;
+
+        AddSample(m_scopes[scope.stats], static_cast<double>(ticks) * m_timestampPeriod * 1.0e-6);
+    }
+
+#ifdef ENGINE_PROFILING
+    if (!CpuProfiler::IsCapturing())
+        return;
+
+    // Without Calibrated Clocks the First Timestamp is Placed at the Submit, Later Ones Keep their Offsets
+    uint64_t first = timestamps[frame.scopes.front().queryIndex] & m_timestampMask;
+    for (const auto &scope : frame.scopes)
+    {
+        uint64_t begin = (timestamps[scope.queryIndex]     & m_timestampMask) - first;
+        uint64_t end   = (timestamps[scope.queryIndex + 1] & m_timestampMask) - first;
+
+        CpuProfiler::Record(
+            m_traceNames[scope.stats],
+            frame.submitTime + static_cast<uint64_t>(static_cast<double>(begin & m_timestampMask) * m_timestampPeriod),
+            frame.submitTime + static_cast<uint64_t>(static_cast<double>(end   & m_timestampMask) * m_timestampPeriod),
+            PROFILE_TRACK_GPU
+        );
+    }
+#endif
+}
+
+void VulkanGpuProfiler::AddSample(VulkanGpuScopeStats &stats, double milliseconds)
+{
+    if (stats.history.size() < GPU_PROFILER_HISTORY)
+        stats.history.push_back(milliseconds);
+    else
+        stats.history[stats.cursor] = milliseconds;
+
+    stats.cursor = (stats.cursor + 1) % GPU_PROFILER_HISTORY;
+
+    double total = 0.0;
+    stats.min = stats.history[0];
+    stats.max = stats.history[0];
+    for (double sample : stats.history)
+    {
+        stats.min = std::min(stats.min, sample);
+        stats.max = std::max(stats.max, sample);
+        total += sample;
+    }
+
+    stats.last = milliseconds;
+    stats.avg  = total / static_cast<double>(stats.history.size());
+}
+
+void VulkanGpuProfiler::WriteTimestamp(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, bool isEnd)
+{
+    // Begin as Soon as the Scope is Reached, End once Every Prior Command has Drained
+    if (m_device.IsSynchronization2Enabled())
+    {
+        VkPipelineStageFlags2 stage = isEnd ? VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT : VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT;
+        vkCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
+    }
+    else
+    {
+        VkPipelineStageFlagBits stage = isEnd ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        vkCmdWriteTimestamp(commandBuffer, stage, queryPool, query);
+    }
+}
+
+void VulkanGpuProfiler::Cleanup()
+{
+    for (auto &frame : m_frames)
+    {
+        if (frame.queryPool != VK_NULL_HANDLE)
+        {
+            vkDestroyQueryPool(m_device.GetHandle(), frame.queryPool, nullptr);
+            frame.queryPool = VK_NULL_HANDLE;
+        }
+    }
+    m_frames.clear();
+}
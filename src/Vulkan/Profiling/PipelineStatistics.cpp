@@ -0,0 +1,190 @@
+#include "Vulkan/Profiling/PipelineStatistics.hpp"
+
+#include <iostream>
+#include <stdexcept>
+
+#include "Vulkan/Core/Device.hpp"
+
+// Results are Written in Bit Order, One Counter per Flag
+static constexpr VkQueryPipelineStatisticFlags PIPELINE_STATISTIC_FLAGS =
+    VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT     |
+    VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT   |
+    VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT   |
+    VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT        |
+    VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT         |
+    VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
+
+static constexpr uint32_t PIPELINE_STATISTIC_COUNT = 6;
+
+VulkanPipelineStatistics::VulkanPipelineStatistics(
+    const VulkanDevice &device,
+    std::vector<Frame> frames,
+    uint32_t maxScopes
+) : m_device(device),
+    m_frames(std::move(frames)),
+    m_maxScopes(maxScopes),
+    m_counters(maxScopes * PIPELINE_STATISTIC_COUNT)
+{}
+
+VulkanPipelineStatistics::~VulkanPipelineStatistics()
+{
+    Cleanup();
+}
+
+std::unique_ptr<VulkanPipelineStatistics> VulkanPipelineStatistics::Create(
+    const VulkanDevice &device,
+    uint32_t frameCount,
+    uint32_t maxScopes
+) {
+    VkResult result = VK_SUCCESS;
+
+    if (!device.IsPipelineStatisticsEnabled())
+    {
+        std::cerr << "[WARNING]\tDevice does not Support Pipeline Statistics Queries.\n";
+        return nullptr;
+    }
+
+    // One Query per Scope, One Pool per Frame in Flight
+    std::vector<Frame> frames(frameCount);
+    for (auto &frame : frames)
+    {
+        VkQueryPoolCreateInfo createInfo{};
+        createInfo.sType              = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        createInfo.queryType          = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+        createInfo.queryCount         = maxScopes;
+        createInfo.pipelineStatistics = PIPELINE_STATISTIC_FLAGS;
+
+        result = vkCreateQueryPool(device.GetHandle(), &createInfo, nullptr, &frame.queryPool);
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "[ERROR]\t'vkCreateQueryPool' Failed with Error Code " << result << "\n";
+
+            for (auto &created : frames)
+            {
+                if (created.queryPool != VK_NULL_HANDLE)
+                    vkDestroyQueryPool(device.GetHandle(), created.queryPool, nullptr);
+            }
+
+            throw std::runtime_error("Failed to Create Pipeline Statistics Query Pool.");
+        }
+
+        frame.scopes.reserve(maxScopes);
+    }
+
+    std::cout << "[INFO]\tPipeline Statistics Created Successfully.\n";
+
+    return std::unique_ptr<VulkanPipelineStatistics>(
+        new VulkanPipelineStatistics(
+            device,
+            std::move(frames),
+            maxScopes
+        )
+    );
+}
+
+void VulkanPipelineStatistics::BeginFrame(VkCommandBuffer commandBuffer, uint32_t currentFrame)
+{
+    m_currentFrame = currentFrame;
+    m_isScopeOpen  = false;
+
+    Frame &frame = m_frames[currentFrame];
+
+    // Written FRAMES_IN_FLIGHT Frames Ago, its Fence has Signaled so Nothing Waits
+    if (frame.isPending)
+        Collect(frame);
+
+    vkCmdResetQueryPool(commandBuffer, frame.queryPool, 0, m_maxScopes);
+
+    frame.scopes.clear();
+    frame.isPending = true;
+}
+
+uint32_t VulkanPipelineStatistics::BeginScope(VkCommandBuffer commandBuffer, const std::string &name)
+{
+    Frame &frame = m_frames[m_currentFrame];
+
+    // Only One Query of a Type may be Active in a Command Buffer
+    if (m_isScopeOpen || frame.scopes.size() >= m_maxScopes)
+        return UINT32_MAX;
+
+    auto it = m_resultIndices.find(name);
+    if (it == m_resultIndices.end())
+    {
+        VulkanPipelineStatisticsResult stats{};
+        stats.name = name;
+
+        it = m_resultIndices.emplace(name, static_cast<uint32_t>(m_results.size())).first;
+        m_results.push_back(std::move(stats));
+    }
+
+    uint32_t scope = static_cast<uint32_t>(frame.scopes.size());
+    frame.scopes.push_back({ it->second, scope });
+
+    vkCmdBeginQuery(commandBuffer, frame.queryPool, scope, 0);
+    m_isScopeOpen = true;
+
+    return scope;
+}
+
+void VulkanPipelineStatistics::EndScope(VkCommandBuffer commandBuffer, uint32_t scope)
+{
+    if (scope == UINT32_MAX)
+        return;
+
+    Frame &frame = m_frames[m_currentFrame];
+    vkCmdEndQuery(commandBuffer, frame.queryPool, frame.scopes[scope].query);
+
+    m_isScopeOpen = false;
+}
+
+void VulkanPipelineStatistics::Collect(Frame &frame)
+{
+    frame.isPending = false;
+
+    if (frame.scopes.empty())
+        return;
+
+    // Sized for Every Scope at Creation, Collecting Never Allocates
+    std::vector<uint64_t> &counters = m_counters;
+    uint32_t               queryCount = static_cast<uint32_t>(frame.scopes.size());
+
+    // No Wait Flag, Results are Skipped if the Queries are Somehow Not Ready
+    VkResult result = vkGetQueryPoolResults(
+        m_device.GetHandle(),
+        frame.queryPool,
+        0,
+        queryCount,
+        queryCount * PIPELINE_STATISTIC_COUNT * sizeof(uint64_t),
+        counters.data(),
+        PIPELINE_STATISTIC_COUNT * sizeof(uint64_t),
+        VK_QUERY_RESULT_64_BIT
+    );
+    if (result != VK_SUCCESS)
+        return;
+
+    for (const auto &scope : frame.scopes)
+    {
+        const uint64_t *values = &counters[scope.query * PIPELINE_STATISTIC_COUNT];
+
+        VulkanPipelineStatisticsResult &stats = m_results[scope.result];
+        stats.inputAssemblyVertices     = values[0];
+        stats.inputAssemblyPrimitives   = values[1];
+        stats.vertexShaderInvocations   = values[2];
+        stats.clippingInvocations       = values[3];
+        stats.clippingPrimitives        = values[4];
+        stats.fragmentShaderInvocations = values[5];
+    }
+}
+
+void VulkanPipelineStatistics::Cleanup()
+{
+    for (auto &frame : m_frames)
+    {
+        if (frame.queryPool != VK_NULL_HANDLE)
+        {
+            vkDestroyQueryPool(m_device.GetHandle(), frame.queryPool, nullptr);
+            frame.queryPool = VK_NULL_HANDLE;
+        }
+    }
+    m_frames.clear();
+}
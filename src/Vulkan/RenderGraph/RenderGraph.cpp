@@ -0,0 +1,843 @@
+#include "Vulkan/RenderGraph/RenderGraph.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+#include "Vulkan/Core/Device.hpp"
+#include "Vulkan/Core/PhysicalDevice.hpp"
+#include "Vulkan/Resources/Image.hpp"
+#include "Vulkan/Resources/MemoryAllocator.hpp"
+#include "Vulkan/Swapchain/ImageView.hpp"
+#include "Vulkan/Sync/BarrierBatch.hpp"
+#include "Vulkan/Profiling/GpuProfiler.hpp"
+#include "Vulkan/Profiling/PipelineStatistics.hpp"
+
+struct VulkanRenderGraphUsageInfo
+{
+    VkPipelineStageFlags2 stages      = 0;
+    VkAccessFlags2        readAccess  = 0;
+    VkAccessFlags2        writeAccess = 0;
+    VkImageLayout         layout      = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkImageUsageFlags     imageUsage  = 0;
+};
+
+static VulkanRenderGraphUsageInfo GetUsageInfo(VulkanRenderGraphUsage usage)
+{
+    switch (usage)
+    {
+        case VulkanRenderGraphUsage::ColorAttachment:
+            return {
+                VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT,
+                VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT,
+                VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
+            };
+        case VulkanRenderGraphUsage::DepthAttachment:
+            return {
+                VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT,
+                VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
+            };
+        case VulkanRenderGraphUsage::DepthRead:
+            return {
+                VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT,
+                0,
+                VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL,
+                VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
+            };
+        case VulkanRenderGraphUsage::Sampled:
+            return {
+                VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT,
+                VK_ACCESS_2_SHADER_READ_BIT,
+                0,
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                VK_IMAGE_USAGE_SAMPLED_BIT
+            };
+        case VulkanRenderGraphUsage::TransferSrc:
+            return {
+                VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                VK_ACCESS_2_TRANSFER_READ_BIT,
+                0,
+                VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                VK_IMAGE_USAGE_TRANSFER_SRC_BIT
+            };
+        case VulkanRenderGraphUsage::TransferDst:
+            return {
+                VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                0,
+                VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                VK_IMAGE_USAGE_TRANSFER_DST_BIT
+            };
+    }
+
+    throw std::runtime_error("Unknown Render Graph Usage.");
+}
+
+static VkImageAspectFlags GetAspectMask(VkFormat format)
+{
+    switch (format)
+    {
+        case VK_FORMAT_D16_UNORM:
+        case VK_FORMAT_X8_D24_UNORM_PACK32:
+        case VK_FORMAT_D32_SFLOAT:
+            return VK_IMAGE_ASPECT_DEPTH_BIT;
+        case VK_FORMAT_D16_UNORM_S8_UINT:
+        case VK_FORMAT_D24_UNORM_S8_UINT:
+        case VK_FORMAT_D32_SFLOAT_S8_UINT:
+            return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+        case VK_FORMAT_S8_UINT:
+            return VK_IMAGE_ASPECT_STENCIL_BIT;
+        default:
+            return VK_IMAGE_ASPECT_COLOR_BIT;
+    }
+}
+
+// Views of Combined Formats Expose Depth Only, Matching the Swapchain's Depth View
+static VkImageAspectFlags GetViewAspectMask(VkFormat format)
+{
+    VkImageAspectFlags aspectMask = GetAspectMask(format);
+
+    return (aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT) ? static_cast<VkImageAspectFlags>(VK_IMAGE_ASPECT_DEPTH_BIT) : aspectMask;
+}
+
+// Writes that Replace Every Texel do not Depend on Earlier Contents
+static bool IsFullOverwrite(bool isWrite, bool isClear, bool isResolve, VulkanRenderGraphUsage usage)
+{
+    return isWrite && (isClear || isResolve || usage == VulkanRenderGraphUsage::TransferDst);
+}
+
+// Images Only Ever Bound as Attachments can Live in Tile Memory
+static bool IsAttachmentOnly(VkImageUsageFlags usage)
+{
+    constexpr VkImageUsageFlags ATTACHMENT_USAGE = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT         |
+                                                   VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT |
+                                                   VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+
+    return usage != 0 && (usage & ~ATTACHMENT_USAGE) == 0;
+}
+
+VulkanRenderGraphPass::VulkanRenderGraphPass(std::string name) :
+    m_name(std::move(name))
+{}
+
+VulkanRenderGraphPass::Access& VulkanRenderGraphPass::AddAccess(
+    VulkanRenderGraphResource resource,
+    VulkanRenderGraphUsage    usage,
+    bool isWrite
+) {
+    VulkanRenderGraphUsageInfo info = GetUsageInfo(usage);
+
+    if ((isWrite ? info.writeAccess : info.readAccess) == 0)
+        throw std::runtime_error("Pass '" + m_name + "' " + (isWrite ? "Writes" : "Reads") + " with an Incompatible Usage.");
+
+    Access access{};
+    access.resource = resource;
+    access.usage    = usage;
+    access.isWrite  = isWrite;
+
+    m_accesses.push_back(access);
+
+    return m_accesses.back();
+}
+
+VulkanRenderGraphPass& VulkanRenderGraphPass::Read(VulkanRenderGraphResource resource, VulkanRenderGraphUsage usage)
+{
+    AddAccess(resource, usage, false);
+    return *this;
+}
+
+VulkanRenderGraphPass& VulkanRenderGraphPass::Write(VulkanRenderGraphResource resource, VulkanRenderGraphUsage usage)
+{
+    AddAccess(resource, usage, true);
+    return *this;
+}
+
+VulkanRenderGraphPass& VulkanRenderGraphPass::ClearColor(VulkanRenderGraphResource resource, VkClearColorValue value)
+{
+    Access &access = AddAccess(resource, VulkanRenderGraphUsage::ColorAttachment, true);
+    access.isClear          = true;
+    access.clearValue.color = value;
+
+    return *this;
+}
+
+VulkanRenderGraphPass& VulkanRenderGraphPass::ClearDepth(VulkanRenderGraphResource resource, float depth)
+{
+    Access &access = AddAccess(resource, VulkanRenderGraphUsage::DepthAttachment, true);
+    access.isClear                 = true;
+    access.clearValue.depthStencil = { depth, 0 };
+
+    return *this;
+}
+
+VulkanRenderGraphPass& VulkanRenderGraphPass::ResolveColor(VulkanRenderGraphResource source, VulkanRenderGraphResource target)
+{
+    Access &access = AddAccess(target, VulkanRenderGraphUsage::ColorAttachment, true);
+    access.resolveSource = source;
+
+    return *this;
+}
+
+VulkanRenderGraphPass& VulkanRenderGraphPass::SetSideEffects()
+{
+    m_hasSideEffects = true;
+    return *this;
+}
+
+VulkanRenderGraphPass& VulkanRenderGraphPass::SetExecute(std::function<void(VkCommandBuffer)> execute)
+{
+    m_execute = std::move(execute);
+    return *this;
+}
+
+VulkanRenderGraph::VulkanRenderGraph(
+    const VulkanPhysicalDevice &physicalDevice,
+    const VulkanDevice         &device,
+    VulkanMemoryAllocator      &allocator
+) : m_physicalDevice(physicalDevice),
+    m_device(device),
+    m_allocator(allocator)
+{}
+
+VulkanRenderGraph::~VulkanRenderGraph()
+{
+    Cleanup();
+}
+
+std::unique_ptr<VulkanRenderGraph> VulkanRenderGraph::Create(
+    const VulkanPhysicalDevice &physicalDevice,
+    const VulkanDevice         &device,
+    VulkanMemoryAllocator      &allocator
+) {
+    // Attachments are Bound at Record Time
+    if (!device.IsDynamicRenderingEnabled())
+        throw std::runtime_error("Render Graph Requires Dynamic Rendering.");
+
+    return std::unique_ptr<VulkanRenderGraph>(
+        new VulkanRenderGraph(
+            physicalDevice,
+            device,
+            allocator
+        )
+    );
+}
+
+VulkanRenderGraphResource VulkanRenderGraph::ImportImage(
+    const std::string &name,
+    VkFormat      format,
+    VkExtent2D    extent,
+    VkImageLayout initialLayout,
+    VkImageLayout finalLayout
+) {
+    Resource resource{};
+    resource.name          = name;
+    resource.format        = format;
+    resource.extent        = extent;
+    resource.isImported    = true;
+    resource.initialLayout = initialLayout;
+    resource.finalLayout   = finalLayout;
+
+    m_resources.push_back(std::move(resource));
+
+    return static_cast<VulkanRenderGraphResource>(m_resources.size() - 1);
+}
+
+VulkanRenderGraphResource VulkanRenderGraph::CreateImage(
+    const std::string &name,
+    VkFormat   format,
+    VkExtent2D extent,
+    VkSampleCountFlagBits samples
+) {
+    Resource resource{};
+    resource.name    = name;
+    resource.format  = format;
+    resource.extent  = extent;
+    resource.samples = samples;
+
+    m_resources.push_back(std::move(resource));
+
+    return static_cast<VulkanRenderGraphResource>(m_resources.size() - 1);
+}
+
+VulkanRenderGraphPass& VulkanRenderGraph::AddPass(const std::string &name)
+{
+    m_passes.push_back(std::unique_ptr<VulkanRenderGraphPass>(new VulkanRenderGraphPass(name)));
+
+    return *m_passes.back();
+}
+
+void VulkanRenderGraph::Compile()
+{
+    ReleaseTransients();
+
+    m_compiledPasses.clear();
+    m_finalBarriers.clear();
+
+    for (auto &resource : m_resources)
+    {
+        resource.usage      = 0;
+        resource.firstPass  = UINT32_MAX;
+        resource.lastPass   = 0;
+        resource.lastStages = 0;
+        resource.lastAccess = 0;
+    }
+
+    // Lifetimes and Usage over the Surviving Passes
+    for (const VulkanRenderGraphPass *pass : CullPasses())
+    {
+        auto index = static_cast<uint32_t>(m_compiledPasses.size());
+
+        for (size_t i = 0; i < pass->m_accesses.size(); ++i)
+        {
+            const auto &access = pass->m_accesses[i];
+
+            if (access.resource >= m_resources.size())
+                throw std::runtime_error("Pass '" + pass->m_name + "' Uses an Unknown Resource.");
+
+            for (size_t j = 0; j < i; ++j)
+            {
+                if (pass->m_accesses[j].resource == access.resource)
+                    throw std::runtime_error("Pass '" + pass->m_name + "' Uses '" + m_resources[access.resource].name + "' Twice.");
+            }
+
+            Resource &resource = m_resources[access.resource];
+            resource.usage    |= GetUsageInfo(access.usage).imageUsage;
+            resource.firstPass = std::min(resource.firstPass, index);
+            resource.lastPass  = std::max(resource.lastPass, index);
+        }
+
+        CompiledPass compiled{};
+        compiled.pass = pass;
+
+        m_compiledPasses.push_back(std::move(compiled));
+    }
+
+    AllocateTransients();
+    PlanBarriers();
+
+    std::cout << "[INFO]\tRender Graph Compiled (" << m_compiledPasses.size() << " of " << m_passes.size()
+              << " Passes, " << m_memorySlots.size() << " Transient Allocations, "
+              << GetTransientMemorySize() << " Bytes).\n";
+}
+
+std::vector<const VulkanRenderGraphPass*> VulkanRenderGraph::CullPasses() const
+{
+    // Imported Images Outlive the Graph, so their Final Contents Matter
+    std::vector<bool> isNeeded(m_resources.size(), false);
+    for (size_t i = 0; i < m_resources.size(); ++i)
+        isNeeded[i] = m_resources[i].isImported;
+
+    std::vector<const VulkanRenderGraphPass*> passes;
+
+    // Walk Backwards, Keeping Passes whose Output a Kept Pass Consumes
+    for (auto it = m_passes.rbegin(); it != m_passes.rend(); ++it)
+    {
+        const VulkanRenderGraphPass &pass = **it;
+
+        bool isKept = pass.m_hasSideEffects || std::any_of(
+            pass.m_accesses.begin(),
+            pass.m_accesses.end(),
+            [&isNeeded](const auto &access) {
+                return access.isWrite && access.resource < isNeeded.size() && isNeeded[access.resource];
+            }
+        );
+
+        if (!isKept)
+        {
+            std::cout << "[INFO]\tRender Graph Culled Pass '" << pass.m_name << "'.\n";
+            continue;
+        }
+
+        for (const auto &access : pass.m_accesses)
+        {
+            if (access.resource >= isNeeded.size())
+                continue;
+
+            if (IsFullOverwrite(access.isWrite, access.isClear, access.resolveSource.has_value(), access.usage))
+                isNeeded[access.resource] = false;
+            else
+                isNeeded[access.resource] = true;
+        }
+
+        passes.push_back(&pass);
+    }
+
+    std::reverse(passes.begin(), passes.end());
+
+    return passes;
+}
+
+void VulkanRenderGraph::AllocateTransients()
+{
+    // Place Transients in Order of First Use
+    std::vector<VulkanRenderGraphResource> transients;
+    for (size_t i = 0; i < m_resources.size(); ++i)
+    {
+        if (!m_resources[i].isImported && m_resources[i].firstPass != UINT32_MAX)
+            transients.push_back(static_cast<VulkanRenderGraphResource>(i));
+    }
+
+    std::sort(
+        transients.begin(),
+        transients.end(),
+        [this](VulkanRenderGraphResource a, VulkanRenderGraphResource b) {
+            return m_resources[a].firstPass < m_resources[b].firstPass;
+        }
+    );
+
+    for (VulkanRenderGraphResource index : transients)
+    {
+        Resource &resource = m_resources[index];
+
+        bool isLazy = IsAttachmentOnly(resource.usage);
+        if (isLazy)
+            resource.usage |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+
+        resource.transientImage = VulkanImage::CreateAliased(
+            m_device,
+            m_allocator,
+            { resource.extent.width, resource.extent.height, 1 },
+            resource.format,
+            resource.usage,
+            resource.samples
+        );
+
+        VkMemoryRequirements memRequirements = resource.transientImage->GetMemoryRequirements();
+
+        // Reuse a Slot whose Images are all Dead Before this One is Born
+        auto slot = std::find_if(
+            m_memorySlots.begin(),
+            m_memorySlots.end(),
+            [&resource, &memRequirements, isLazy](const MemorySlot &slot) {
+                return slot.lastPass < resource.firstPass && slot.isLazy == isLazy &&
+                       (slot.memoryTypeBits & memRequirements.memoryTypeBits) != 0;
+            }
+        );
+
+        if (slot == m_memorySlots.end())
+        {
+            m_memorySlots.emplace_back();
+            slot = std::prev(m_memorySlots.end());
+            slot->memoryTypeBits = memRequirements.memoryTypeBits;
+            slot->isLazy         = isLazy;
+        }
+
+        slot->size            = std::max(slot->size, memRequirements.size);
+        slot->alignment       = std::max(slot->alignment, memRequirements.alignment);
+        slot->memoryTypeBits &= memRequirements.memoryTypeBits;
+        slot->lastPass        = resource.lastPass;
+        slot->resources.push_back(index);
+    }
+
+    // Allocate Each Slot Once and Bind Every Image Sharing It
+    for (auto &slot : m_memorySlots)
+    {
+        VkMemoryPropertyFlags properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        if (slot.isLazy)
+            properties |= VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+
+        VkMemoryRequirements memRequirements{};
+        memRequirements.size           = slot.size;
+        memRequirements.alignment      = slot.alignment;
+        memRequirements.memoryTypeBits = slot.memoryTypeBits;
+
+        slot.allocation = m_allocator.Allocate(
+            m_physicalDevice,
+            m_device,
+            memRequirements,
+            properties,
+            VulkanMemoryCategory::Image
+        );
+
+        for (VulkanRenderGraphResource index : slot.resources)
+        {
+            Resource &resource = m_resources[index];
+
+            resource.transientImage->BindMemory(slot.allocation);
+            resource.transientView = VulkanImageView::CreateFromImage(
+                m_device,
+                *resource.transientImage,
+                VK_IMAGE_VIEW_TYPE_2D,
+                GetViewAspectMask(resource.format)
+            );
+
+            resource.image = resource.transientImage->GetHandle();
+            resource.view  = resource.transientView->GetHandle();
+        }
+    }
+}
+
+void VulkanRenderGraph::PlanBarriers()
+{
+    // Final Use of Each Resource, Waited On by the Next Image in its Memory
+    std::vector<bool> wasWritten(m_resources.size(), false);
+    for (const auto &compiled : m_compiledPasses)
+    {
+        for (const auto &access : compiled.pass->m_accesses)
+        {
+            VulkanRenderGraphUsageInfo info = GetUsageInfo(access.usage);
+            Resource &resource = m_resources[access.resource];
+
+            if (access.isWrite || wasWritten[access.resource])
+                resource.lastStages = 0;
+
+            resource.lastStages |= info.stages;
+            resource.lastAccess  = access.isWrite ? info.writeAccess : 0;
+
+            wasWritten[access.resource] = access.isWrite;
+        }
+    }
+
+    // The First Image in a Slot Follows the Last One of the Previous Frame
+    std::vector<VulkanRenderGraphResource> previousOwner(m_resources.size());
+    for (const auto &slot : m_memorySlots)
+    {
+        for (size_t i = 0; i < slot.resources.size(); ++i)
+            previousOwner[slot.resources[i]] = slot.resources[i == 0 ? slot.resources.size() - 1 : i - 1];
+    }
+
+    struct State
+    {
+        bool                 isUsed      = false;
+        bool                 isWritten   = false;
+        VkImageLayout        layout      = VK_IMAGE_LAYOUT_UNDEFINED;
+        VkPipelineStageFlags2 writeStages = 0;
+        VkAccessFlags2        writeAccess = 0;
+        VkPipelineStageFlags2 readStages  = 0;
+    };
+
+    std::vector<State> states(m_resources.size());
+
+    for (uint32_t index = 0; index < m_compiledPasses.size(); ++index)
+    {
+        CompiledPass &compiled = m_compiledPasses[index];
+
+        std::vector<std::pair<VulkanRenderGraphResource, VulkanRenderGraphResource>> resolveTargets;
+
+        for (const auto &access : compiled.pass->m_accesses)
+        {
+            VulkanRenderGraphUsageInfo info = GetUsageInfo(access.usage);
+
+            const Resource &resource = m_resources[access.resource];
+            State          &state    = states[access.resource];
+
+            Barrier barrier{};
+            barrier.resource  = access.resource;
+            barrier.oldLayout = state.layout;
+            barrier.newLayout = info.layout;
+            barrier.dstStages = info.stages;
+            barrier.dstAccess = access.isWrite ? info.readAccess | info.writeAccess : info.readAccess;
+
+            bool isNeeded = false;
+
+            if (!state.isUsed && resource.isImported)
+            {
+                // Same Stage as the First Use, Chaining with the Acquire Semaphore
+                barrier.oldLayout = resource.initialLayout;
+                barrier.srcStages = info.stages;
+                isNeeded  = resource.initialLayout != info.layout;
+            }
+            else if (!state.isUsed)
+            {
+                // Contents of Aliased Memory are Undefined, Wait for its Previous Owner
+                const Resource &owner = m_resources[previousOwner[access.resource]];
+
+                barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                barrier.srcAccess = owner.lastAccess;
+                barrier.srcStages = owner.lastStages;
+                isNeeded  = true;
+            }
+            else if (state.isWritten)
+            {
+                // Read or Write after Write
+                barrier.srcAccess = state.writeAccess;
+                barrier.srcStages = state.writeStages;
+                isNeeded  = true;
+            }
+            else if (access.isWrite || state.layout != info.layout)
+            {
+                // Write after Read, Execution Dependency Only
+                barrier.srcStages = state.readStages;
+                isNeeded  = true;
+            }
+            else if ((info.stages & ~state.readStages) != 0 && state.writeStages != 0)
+            {
+                // Read after Read by a Stage the Last Write was not Made Visible To
+                barrier.srcAccess = state.writeAccess;
+                barrier.srcStages = state.writeStages;
+                isNeeded  = true;
+            }
+
+            if (isNeeded)
+                compiled.barriers.push_back(barrier);
+
+            // Attachments
+            bool isAttachment = access.usage == VulkanRenderGraphUsage::ColorAttachment ||
+                                access.usage == VulkanRenderGraphUsage::DepthAttachment ||
+                                access.usage == VulkanRenderGraphUsage::DepthRead;
+            if (isAttachment)
+            {
+                bool isUndefined = !state.isUsed && (!resource.isImported || resource.initialLayout == VK_IMAGE_LAYOUT_UNDEFINED);
+
+                Attachment attachment{};
+                attachment.resource   = access.resource;
+                attachment.layout     = info.layout;
+                attachment.clearValue = access.clearValue;
+                attachment.loadOp     = access.isClear ? VK_ATTACHMENT_LOAD_OP_CLEAR
+                                      : isUndefined    ? VK_ATTACHMENT_LOAD_OP_DONT_CARE
+                                                       : VK_ATTACHMENT_LOAD_OP_LOAD;
+                attachment.storeOp    = resource.isImported || index < resource.lastPass
+                                      ? VK_ATTACHMENT_STORE_OP_STORE
+                                      : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+
+                if (access.resolveSource)
+                {
+                    resolveTargets.emplace_back(*access.resolveSource, access.resource);
+                }
+                else if (access.usage == VulkanRenderGraphUsage::ColorAttachment)
+                {
+                    compiled.colorAttachments.push_back(attachment);
+                }
+                else
+                {
+                    if (compiled.depthAttachment)
+                        throw std::runtime_error("Pass '" + compiled.pass->m_name + "' has Two Depth Attachments.");
+
+                    compiled.depthAttachment = attachment;
+                }
+
+                if (compiled.renderArea.width == 0 && compiled.renderArea.height == 0)
+                    compiled.renderArea = resource.extent;
+            }
+
+            // Advance State
+            state.isUsed = true;
+            state.layout = info.layout;
+
+            if (access.isWrite)
+            {
+                state.isWritten   = true;
+                state.writeStages = info.stages;
+                state.writeAccess = info.writeAccess;
+                state.readStages  = 0;
+            }
+            else
+            {
+                state.isWritten   = false;
+                state.readStages |= info.stages;
+            }
+        }
+
+        // Resolve Targets are Bound Alongside the Multisampled Attachment they Average
+        for (auto [source, target] : resolveTargets)
+        {
+            auto it = std::find_if(
+                compiled.colorAttachments.begin(),
+                compiled.colorAttachments.end(),
+                [source](const Attachment &attachment) { return attachment.resource == source; }
+            );
+
+            if (it == compiled.colorAttachments.end())
+                throw std::runtime_error("Pass '" + compiled.pass->m_name + "' Resolves '" + m_resources[source].name + "' which it does not Render To.");
+            if (m_resources[source].samples == VK_SAMPLE_COUNT_1_BIT || m_resources[target].samples != VK_SAMPLE_COUNT_1_BIT)
+                throw std::runtime_error("Pass '" + compiled.pass->m_name + "' Resolves Between Incompatible Sample Counts.");
+
+            it->resolveTarget = target;
+        }
+    }
+
+    // Leave Imported Images in the Layout their Owner Expects
+    for (size_t i = 0; i < m_resources.size(); ++i)
+    {
+        const Resource &resource = m_resources[i];
+        const State    &state    = states[i];
+
+        if (!resource.isImported || !state.isUsed)
+            continue;
+        if (resource.finalLayout == VK_IMAGE_LAYOUT_UNDEFINED || resource.finalLayout == state.layout)
+            continue;
+
+        // Ends Where the Next Use of the Final Layout and the Next Barrier out of It Begin, so Both Chain After the Transition
+        VulkanLayoutSync nextSync = VulkanBarrierBatch::GetLayoutSync(resource.finalLayout, resource.usage, false);
+        nextSync.stages |= VulkanBarrierBatch::GetLayoutSync(resource.finalLayout, resource.usage, true).stages;
+
+        Barrier barrier{};
+        barrier.resource  = static_cast<VulkanRenderGraphResource>(i);
+        barrier.oldLayout = state.layout;
+        barrier.newLayout = resource.finalLayout;
+        barrier.srcStages = state.isWritten ? state.writeStages : state.readStages;
+        barrier.srcAccess = state.isWritten ? state.writeAccess : 0;
+        barrier.dstStages = nextSync.stages;
+        barrier.dstAccess = nextSync.access;
+
+        m_finalBarriers.push_back(barrier);
+    }
+}
+
+void VulkanRenderGraph::SetImportedImage(VulkanRenderGraphResource resource, VkImage image, VkImageView view)
+{
+    if (resource >= m_resources.size() || !m_resources[resource].isImported)
+        throw std::runtime_error("Render Graph Resource is not Imported.");
+
+    m_resources[resource].image = image;
+    m_resources[resource].view  = view;
+}
+
+void VulkanRenderGraph::RecordBarriers(VkCommandBuffer commandBuffer, const std::vector<Barrier> &barriers, std::pmr::memory_resource *arena) const
+{
+    // One Call per Pass, Each Barrier Keeps its Own Stages
+    VulkanBarrierBatch batch(m_device, arena);
+
+    for (const auto &barrier : barriers)
+    {
+        const Resource &resource = m_resources[barrier.resource];
+
+        VkImageMemoryBarrier2 imageBarrier{};
+        imageBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+        imageBarrier.srcStageMask        = barrier.srcStages;
+        imageBarrier.srcAccessMask       = barrier.srcAccess;
+        imageBarrier.dstStageMask        = barrier.dstStages;
+        imageBarrier.dstAccessMask       = barrier.dstAccess;
+        imageBarrier.oldLayout           = barrier.oldLayout;
+        imageBarrier.newLayout           = barrier.newLayout;
+        imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.image               = resource.image;
+        imageBarrier.subresourceRange    = { GetAspectMask(resource.format), 0, 1, 0, 1 };
+
+        batch.AddImage(imageBarrier);
+    }
+
+    batch.Record(commandBuffer);
+}
+
+void VulkanRenderGraph::Execute(
+    VkCommandBuffer            commandBuffer,
+    std::pmr::memory_resource *arena
+) const {
+    for (const auto &resource : m_resources)
+    {
+        if (resource.firstPass != UINT32_MAX && resource.image == VK_NULL_HANDLE)
+            throw std::runtime_error("Render Graph Resource '" + resource.name + "' has no Image.");
+    }
+
+    for (const auto &compiled : m_compiledPasses)
+    {
+        uint32_t scope           = m_profiler   ? m_profiler->BeginScope(commandBuffer, compiled.pass->GetName())   : 0;
+        uint32_t statisticsScope = m_statistics ? m_statistics->BeginScope(commandBuffer, compiled.pass->GetName()) : 0;
+
+        ExecutePass(commandBuffer, compiled, arena);
+
+        if (m_statistics)
+            m_statistics->EndScope(commandBuffer, statisticsScope);
+        if (m_profiler)
+            m_profiler->EndScope(commandBuffer, scope);
+    }
+
+    RecordBarriers(commandBuffer, m_finalBarriers, arena);
+}
+
+void VulkanRenderGraph::ExecutePass(VkCommandBuffer commandBuffer, const CompiledPass &compiled, std::pmr::memory_resource *arena) const
+{
+    RecordBarriers(commandBuffer, compiled.barriers, arena);
+
+    bool hasAttachments = !compiled.colorAttachments.empty() || compiled.depthAttachment;
+    if (!hasAttachments)
+    {
+        if (compiled.pass->m_execute)
+            compiled.pass->m_execute(commandBuffer);
+
+        return;
+    }
+
+    auto GetAttachmentInfo = [this](const Attachment &attachment) {
+        VkRenderingAttachmentInfo info{};
+        info.sType       = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
+        info.imageView   = m_resources[attachment.resource].view;
+        info.imageLayout = attachment.layout;
+        info.loadOp      = attachment.loadOp;
+        info.storeOp     = attachment.storeOp;
+        info.clearValue  = attachment.clearValue;
+
+        if (attachment.resolveTarget)
+        {
+            info.resolveMode        = VK_RESOLVE_MODE_AVERAGE_BIT;
+            info.resolveImageView   = m_resources[*attachment.resolveTarget].view;
+            info.resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
+
+        return info;
+    };
+
+    std::pmr::vector<VkRenderingAttachmentInfo> colorAttachments(arena);
+    colorAttachments.reserve(compiled.colorAttachments.size());
+    for (const auto &attachment : compiled.colorAttachments)
+        colorAttachments.push_back(GetAttachmentInfo(attachment));
+
+    VkRenderingAttachmentInfo depthAttachment{};
+    if (compiled.depthAttachment)
+        depthAttachment = GetAttachmentInfo(*compiled.depthAttachment);
+
+    // Begin Rendering
+    VkRenderingInfo renderingInfo{};
+    renderingInfo.sType                = VK_STRUCTURE_TYPE_RENDERING_INFO;
+    renderingInfo.renderArea.offset    = {0, 0};
+    renderingInfo.renderArea.extent    = compiled.renderArea;
+    renderingInfo.layerCount           = 1;
+    renderingInfo.colorAttachmentCount = static_cast<uint32_t>(colorAttachments.size());
+    renderingInfo.pColorAttachments    = colorAttachments.data();
+    renderingInfo.pDepthAttachment     = compiled.depthAttachment ? &depthAttachment : nullptr;
+
+    vkCmdBeginRendering(commandBuffer, &renderingInfo);
+
+    if (compiled.pass->m_execute)
+        compiled.pass->m_execute(commandBuffer);
+
+    vkCmdEndRendering(commandBuffer);
+}
+
+VkDeviceSize VulkanRenderGraph::GetTransientMemorySize() const
+{
+    VkDeviceSize size = 0;
+    for (const auto &slot : m_memorySlots)
+        size += slot.size;
+
+    return size;
+}
+
+void VulkanRenderGraph::ReleaseTransients()
+{
+    // Images Before the Memory they are Bound To
+    for (auto &resource : m_resources)
+    {
+        if (resource.isImported)
+            continue;
+
+        resource.transientView.reset();
+        resource.transientImage.reset();
+
+        resource.image = VK_NULL_HANDLE;
+        resource.view  = VK_NULL_HANDLE;
+    }
+
+    for (auto &slot : m_memorySlots)
+        m_allocator.Free(m_device, slot.allocation);
+
+    m_memorySlots.clear();
+}
+
+void VulkanRenderGraph::Cleanup()
+{
+    ReleaseTransients();
+
+    m_compiledPasses.clear();
+    m_finalBarriers.clear();
+    m_passes.clear();
+    m_resources.clear();
+}
@@ -1,7 +1,12 @@
 #include "Vulkan/Renderer/Renderer.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+
 #include "Vulkan/Core/Context.hpp"
 #include "Vulkan/Core/Device.hpp"
+#include "Vulkan/Core/PhysicalDevice.hpp"
 #include "Vulkan/Resources/MemoryAllocator.hpp"
 #include "Vulkan/Swapchain/Swapchain.hpp"
 #include "Vulkan/RenderPass/RenderPass.hpp"
@@ -9,6 +14,13 @@
 #include "Vulkan/Commands/CommandPool.hpp"
 #include "Vulkan/Descriptors/DescriptorPool.hpp"
 #include "Vulkan/Pipeline/Pipeline.hpp"
+#include "Vulkan/Pipeline/PipelineLibrary.hpp"
+#include "Vulkan/RenderGraph/RenderGraph.hpp"
+#include "Vulkan/Resources/Image.hpp"
+#include "Vulkan/Swapchain/ImageView.hpp"
+#include "Vulkan/Resources/FrameReadback.hpp"
+#include "Vulkan/Profiling/GpuProfiler.hpp"
+#include "Vulkan/Profiling/PipelineStatistics.hpp"
 
 #include "Scene/Scene.hpp"
 #include "Scene/Camera.hpp"
@@ -16,6 +28,9 @@
 
 #include "Vulkan/Buffers/Uniform.hpp"
 
+#include "Profiling/CpuProfiler.hpp"
+#include "Memory/FrameArena.hpp"
+
 VulkanRenderer::VulkanRenderer(
     std::unique_ptr<VulkanContext>         context,
     std::unique_ptr<VulkanMemoryAllocator> allocator,
@@ -23,19 +38,21 @@ VulkanRenderer::VulkanRenderer(
     std::unique_ptr<VulkanRenderPass>      renderPass,
     std::unique_ptr<VulkanSync>            sync,
     std::unique_ptr<VulkanCommandPool>     commandPool,
-    std::unique_ptr<VulkanDescriptorPool>  descriptorPool
+    std::unique_ptr<VulkanDescriptorPool>  descriptorPool,
+    std::unique_ptr<VulkanPipelineLibrary> pipelineLibrary
 ) : m_context       (std::move(context)),
     m_allocator     (std::move(allocator)),
     m_swapchain     (std::move(swapchain)),
     m_renderPass    (std::move(renderPass)),
     m_sync          (std::move(sync)),
     m_commandPool   (std::move(commandPool)),
-    m_descriptorPool(std::move(descriptorPool))
+    m_descriptorPool(std::move(descriptorPool)),
+    m_pipelineLibrary(std::move(pipelineLibrary))
 {}
 
 VulkanRenderer::~VulkanRenderer() = default;
 
-std::unique_ptr<VulkanRenderer> VulkanRenderer::Create(const Window &window)
+std::unique_ptr<VulkanRenderer> VulkanRenderer::Create(const Window *window)
 {
     // Context
     auto context = VulkanContext::Create(window, FRAMES_IN_FLIGHT);
@@ -43,20 +60,39 @@ std::unique_ptr<VulkanRenderer> VulkanRenderer::Create(const Window &window)
     // Memory Allocator
     auto allocator = VulkanMemoryAllocator::Create();
 
-    // Swapchain
-    auto swapchain = VulkanSwapchain::Create(
-        window,
-        context->GetSurface(),
-        context->GetPhysicalDevice(),
-        context->GetDevice(),
-        FRAMES_IN_FLIGHT
-    );
+    // Swapchain, Offscreen Images when there is Nothing to Present To
+    std::unique_ptr<VulkanSwapchain> swapchain;
+    if (context->IsHeadless())
+    {
+        swapchain = VulkanSwapchain::CreateHeadless(
+            context->GetPhysicalDevice(),
+            context->GetDevice(),
+            {static_cast<uint32_t>(SCREEN_WIDTH), static_cast<uint32_t>(SCREEN_HEIGHT)},
+            FRAMES_IN_FLIGHT
+        );
+    }
+    else
+    {
+        swapchain = VulkanSwapchain::Create(
+            *window,
+            *context->GetSurface(),
+            context->GetPhysicalDevice(),
+            context->GetDevice(),
+            FRAMES_IN_FLIGHT
+        );
+    }
 
-    // Render Pass
-    auto renderPass = VulkanRenderPass::Create(
-        context->GetDevice(),
-        *swapchain
-    );
+    // Render Pass, Skipped when Attachments are Given at Record Time
+    bool dynamicRendering = USE_DYNAMIC_RENDERING && context->GetDevice().IsDynamicRenderingEnabled();
+
+    std::unique_ptr<VulkanRenderPass> renderPass;
+    if (!dynamicRendering)
+    {
+        renderPass = VulkanRenderPass::Create(
+            context->GetDevice(),
+            *swapchain
+        );
+    }
 
     // Create Swapchain Resources
     swapchain->CreateImages(
@@ -64,7 +100,16 @@ std::unique_ptr<VulkanRenderer> VulkanRenderer::Create(const Window &window)
         *allocator
     );
     swapchain->CreateImageViews();
-    swapchain->CreateFramebuffers(*renderPass);
+
+    // The Render Graph Owns Depth as a Transient Attachment
+    if (renderPass)
+    {
+        swapchain->CreateDepthResources(
+            context->GetPhysicalDevice(),
+            *allocator
+        );
+        swapchain->CreateFramebuffers(*renderPass);
+    }
 
     // Synchronization
     auto sync = VulkanSync::Create(
@@ -73,59 +118,279 @@ std::unique_ptr<VulkanRenderer> VulkanRenderer::Create(const Window &window)
     );
 
     // Command Pool and Buffers
-    auto commandPool = VulkanCommandPool::Create(context->GetDevice());
+    auto commandPool = VulkanCommandPool::Create(context->GetDevice(), context->GetDevice().GetGraphicsQueueFamily());
     commandPool->CreateCommandBuffers(FRAMES_IN_FLIGHT);
     
     // Descriptor Pool
     auto descriptorPool = VulkanDescriptorPool::Create(context->GetDevice(), FRAMES_IN_FLIGHT);
 
-    return std::unique_ptr<VulkanRenderer>(new VulkanRenderer(
+    // Pipeline Library
+    auto pipelineLibrary = VulkanPipelineLibrary::Create(
+        context->GetDevice(),
+        *swapchain,
+        renderPass.get(),
+        SHADER_DIRECTORY,
+        PIPELINE_CACHE_PATH,
+        SHADER_HOT_RELOAD,
+        FRAMES_IN_FLIGHT
+    );
+
+    auto renderer = std::unique_ptr<VulkanRenderer>(new VulkanRenderer(
         std::move(context),
         std::move(allocator),
         std::move(swapchain),
         std::move(renderPass),
         std::move(sync),
         std::move(commandPool),
-        std::move(descriptorPool)
+        std::move(descriptorPool),
+        std::move(pipelineLibrary)
     ));
+
+    for (uint32_t i = 0; i < FRAMES_IN_FLIGHT; ++i)
+        renderer->m_frameArenas.push_back(FrameArena::Create(FRAME_ARENA_SIZE));
+
+    const VulkanDevice &device = renderer->m_context->GetDevice();
+    renderer->m_transferCommandPool = VulkanCommandPool::Create(device, device.GetTransferQueueFamily());
+
+    // GPU Profiler
+    if (ENABLE_GPU_PROFILER)
+    {
+        renderer->m_gpuProfiler = VulkanGpuProfiler::Create(
+            renderer->m_context->GetPhysicalDevice(),
+            renderer->m_context->GetDevice(),
+            FRAMES_IN_FLIGHT
+        );
+    }
+
+    if (dynamicRendering)
+        renderer->BuildRenderGraph();
+
+    return renderer;
+}
+
+void VulkanRenderer::BuildRenderGraph()
+{
+    m_renderGraph = VulkanRenderGraph::Create(
+        m_context->GetPhysicalDevice(),
+        m_context->GetDevice(),
+        *m_allocator
+    );
+
+    // Swapchain Contents are Discarded on Acquire, then Presented or Copied Out
+    m_backbuffer = m_renderGraph->ImportImage(
+        "Backbuffer",
+        m_swapchain->GetFormat(),
+        m_swapchain->GetExtent(),
+        VK_IMAGE_LAYOUT_UNDEFINED,
+        m_swapchain->GetFinalLayout()
+    );
+
+    m_samples = m_context->GetPhysicalDevice().ClampSampleCount(MSAA_SAMPLES);
+
+    VulkanRenderGraphResource depth = m_renderGraph->CreateImage(
+        "Depth",
+        m_swapchain->GetDepthFormat(),
+        m_swapchain->GetExtent(),
+        m_samples
+    );
+
+    // Reverse-Z Clears Depth to the Far Plane at 0
+    VulkanRenderGraphPass &opaquePass = m_renderGraph->AddPass("Opaque")
+        .ClearDepth(depth, 0.0f)
+        .SetExecute([this](VkCommandBuffer vkCommandBuffer) { RecordScene(vkCommandBuffer); });
+
+    if (m_samples == VK_SAMPLE_COUNT_1_BIT)
+    {
+        opaquePass.ClearColor(m_backbuffer, {{0.0f, 0.0f, 0.0f, 1.0f}});
+    }
+    else
+    {
+        // Multisampled Color is Resolved In-Pass and Never Stored
+        VulkanRenderGraphResource color = m_renderGraph->CreateImage(
+            "Color",
+            m_swapchain->GetFormat(),
+            m_swapchain->GetExtent(),
+            m_samples
+        );
+
+        opaquePass
+            .ClearColor(color, {{0.0f, 0.0f, 0.0f, 1.0f}})
+            .ResolveColor(color, m_backbuffer);
+    }
+
+    m_renderGraph->Compile();
+    m_renderGraph->SetProfiler(m_gpuProfiler.get());
 }
 
 void VulkanRenderer::Finish()
 {
     if (m_context)
+    {
         vkDeviceWaitIdle(m_context->GetDevice().GetHandle());
+
+        m_allocator->CollectRetired(m_context->GetDevice(), UINT64_MAX);
+
+        // Every Upload is Done, Reclaimed While their Command Pools Still Exist
+        m_sync->CollectUploads(true);
+    }
+
+    if (m_readback)
+        m_readback->CollectAll();
 }
 
-void VulkanRenderer::Draw()
+void VulkanRenderer::RequestReadback(VulkanReadbackCallback callback)
+{
+    m_readbackCallback = std::move(callback);
+}
+
+void VulkanRenderer::SetPipelineStatisticsEnabled(bool enabled)
+{
+    if (enabled && !m_pipelineStatistics)
+    {
+        m_pipelineStatistics = VulkanPipelineStatistics::Create(
+            m_context->GetDevice(),
+            FRAMES_IN_FLIGHT
+        );
+    }
+
+    m_pipelineStatisticsEnabled = enabled && m_pipelineStatistics;
+}
+
+void VulkanRenderer::BeginFrame()
 {
+    PROFILE_ZONE("Renderer::BeginFrame");
+
+    if (m_isFrameBegun)
+        return;
+
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point waitStart = Clock::now();
+
     m_sync->WaitForFence(m_currentFrame);
 
+    m_stats.waitTime = std::chrono::duration<double>(Clock::now() - waitStart).count();
+
+    // Recording Scratch from when this Frame Index was Last Used is No Longer Referenced
+    m_frameArenas[m_currentFrame]->Reset();
+
+    // The Fence Covers the Copy Recorded FRAMES_IN_FLIGHT Frames Ago
+    if (m_readback)
+        m_readback->Collect(m_currentFrame);
+
+    // Heap Budgets Shift as Other Processes Allocate
+    m_allocator->UpdateBudget(m_context->GetPhysicalDevice(), m_context->GetDevice());
+
+    // Memory Moved Away FRAMES_IN_FLIGHT Frames Ago is No Longer Read
+    m_allocator->CollectRetired(m_context->GetDevice(), m_frameNumber);
+
+    m_isFrameBegun = true;
+}
+
+void VulkanRenderer::Draw()
+{
+    PROFILE_ZONE("Renderer::Draw");
+
+    BeginFrame();
+
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point recordStart = Clock::now();
+
+    m_stats.drawCalls = 0;
+    m_stats.instances = 0;
+
+    FrameArena &arena = *m_frameArenas[m_currentFrame];
+
+    // Swap in Reloaded Pipelines
+    m_pipelineLibrary->Update(m_frameNumber);
+    VulkanPipeline &pipeline = m_pipelineLibrary->Get(m_pipelineHandle);
+
     // Begin Frame
     VkCommandBuffer vkCommandBuffer = m_commandPool->BeginFrame(m_currentFrame);
-    uint32_t        imageIndex      = m_pipeline->BeginFrame(
+
+    // Queries are Reset Outside the Render Pass, so Before it Begins
+    uint32_t frameScope = 0;
+    if (m_gpuProfiler)
+    {
+        m_gpuProfiler->BeginFrame(vkCommandBuffer, m_currentFrame);
+        frameScope = m_gpuProfiler->BeginScope(vkCommandBuffer, "Frame");
+    }
+
+    // Copies are Recorded Ahead of Every Pass, so the Frame Already Reads the Moved Buffers
+    if (DEFRAG_BYTES_PER_FRAME > 0)
+        m_allocator->Defragment(m_context->GetDevice(), vkCommandBuffer, m_frameNumber, m_currentFrame, DEFRAG_BYTES_PER_FRAME);
+
+    VulkanPipelineStatistics *statistics = m_pipelineStatisticsEnabled ? m_pipelineStatistics.get() : nullptr;
+    if (statistics)
+        statistics->BeginFrame(vkCommandBuffer, m_currentFrame);
+
+    uint32_t imageIndex = pipeline.BeginFrame(
         *m_swapchain,
-        *m_renderPass,
+        m_renderPass.get(),
         *m_sync,
         vkCommandBuffer,
         m_currentFrame
     );
     
-    m_pipeline->Bind(vkCommandBuffer, m_scene->GetDescriptorSets(m_currentFrame));
-
-    // Bind Meshes
-    for (auto &mesh : m_scene->GetMeshes())
+    if (m_renderGraph)
     {
-        mesh->Bind(vkCommandBuffer, m_currentFrame);
+        m_renderGraph->SetImportedImage(
+            m_backbuffer,
+            m_swapchain->GetImages()[imageIndex]->GetHandle(),
+            m_swapchain->GetImageViews()[imageIndex]->GetHandle()
+        );
+        m_renderGraph->SetPipelineStatistics(statistics);
+        m_renderGraph->Execute(vkCommandBuffer, &arena);
     }
+    else
+    {
+        uint32_t opaqueScope     = m_gpuProfiler ? m_gpuProfiler->BeginScope(vkCommandBuffer, "Opaque") : 0;
+        uint32_t statisticsScope = statistics    ? statistics->BeginScope(vkCommandBuffer, "Opaque")    : 0;
 
-    // Draw Meshes
-    for (auto &mesh : m_scene->GetMeshes())
+        RecordScene(vkCommandBuffer);
+
+        if (statistics)
+            statistics->EndScope(vkCommandBuffer, statisticsScope);
+        if (m_gpuProfiler)
+            m_gpuProfiler->EndScope(vkCommandBuffer, opaqueScope);
+
+        pipeline.EndRenderPass(m_renderPass.get(), vkCommandBuffer);
+    }
+
+    // Copy the Finished Image Out, Delivered once this Frame's Fence is Waited On Again
+    if (m_readbackCallback)
     {
-        mesh->Draw(vkCommandBuffer);
+        if (!m_readback)
+        {
+            m_readback = VulkanFrameReadback::Create(
+                m_context->GetPhysicalDevice(),
+                m_context->GetDevice(),
+                *m_allocator,
+                m_swapchain->GetExtent(),
+                m_swapchain->GetFormat(),
+                FRAMES_IN_FLIGHT
+            );
+        }
+
+        m_readback->Record(
+            vkCommandBuffer,
+            *m_swapchain->GetImages()[imageIndex],
+            m_swapchain->GetFinalLayout(),
+            m_currentFrame,
+            m_frameNumber,
+            std::move(m_readbackCallback)
+        );
+        m_readbackCallback = nullptr;
     }
 
+    if (m_gpuProfiler)
+        m_gpuProfiler->EndScope(vkCommandBuffer, frameScope);
+
+    Clock::time_point submitStart = Clock::now();
+
     // End Frame
-    m_pipeline->EndFrame(
+    pipeline.EndFrame(
         *m_swapchain,
         *m_sync,
         vkCommandBuffer,
@@ -133,51 +398,93 @@ void VulkanRenderer::Draw()
         imageIndex
     );
 
+    Clock::time_point submitEnd = Clock::now();
+
+    if (m_gpuProfiler)
+        m_gpuProfiler->MarkSubmitted(m_currentFrame);
+
+    m_stats.recordTime = std::chrono::duration<double>(submitStart - recordStart).count();
+    m_stats.submitTime = std::chrono::duration<double>(submitEnd   - submitStart).count();
+
     m_currentFrame = (m_currentFrame + 1) % FRAMES_IN_FLIGHT;
+    m_frameNumber++;
+    m_isFrameBegun = false;
+}
+
+void VulkanRenderer::RecordScene(VkCommandBuffer vkCommandBuffer)
+{
+    PROFILE_ZONE("Renderer::RecordScene");
+
+    VulkanPipeline &pipeline = m_pipelineLibrary->Get(m_pipelineHandle);
+    pipeline.Bind(vkCommandBuffer, m_scene->GetDescriptorSets(m_currentFrame));
+
+    // Sort Front to Back so Early Depth Testing Rejects Hidden Fragments
+    const glm::vec3 &cameraPosition = m_scene->GetCamera()->GetPosition();
+
+    m_drawList.clear();
+    for (auto &mesh : m_scene->GetMeshes())
+    {
+        glm::vec3 offset = mesh->GetCenter() - cameraPosition;
+        m_drawList.emplace_back(glm::dot(offset, offset), mesh.get());
+    }
+
+    std::sort(
+        m_drawList.begin(),
+        m_drawList.end(),
+        [](const auto &a, const auto &b) { return a.first < b.first; }
+    );
+
+    // Draw Meshes
+    for (auto &[distance, mesh] : m_drawList)
+    {
+        mesh->Bind(vkCommandBuffer, m_currentFrame);
+        mesh->Draw(vkCommandBuffer);
+
+        m_stats.drawCalls++;
+        m_stats.instances += mesh->GetInstanceCount();
+    }
 }
 
 void VulkanRenderer::SetScene(std::shared_ptr<VulkanScene> scene)
 {
     m_scene = std::move(scene);
 
+    VulkanPipelineDesc desc{};
+    desc.vertexShaderPath = SHADER_DIRECTORY + "/renderVS.spv";
+    desc.pixelShaderPath  = SHADER_DIRECTORY + "/renderPS.spv";
+
     // Binding Description
-    std::vector<VkVertexInputBindingDescription> bindingDescs(1);
-    bindingDescs[0].binding   = 0;  // Vertex
-    bindingDescs[0].stride    = sizeof(Vertex);
-    bindingDescs[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-
-    // Attribute Description
-    std::vector<VkVertexInputAttributeDescription> attrDescs(2);
-    attrDescs[0].binding  = 0;  // Vertex Position
-    attrDescs[0].location = 0;
-    attrDescs[0].format   = VK_FORMAT_R32G32B32_SFLOAT;
-    attrDescs[0].offset   = offsetof(Vertex, pos);
-
-    attrDescs[1].binding  = 0;  // Vertex Color
-    attrDescs[1].location = 1;
-    attrDescs[1].format   = VK_FORMAT_R32G32B32_SFLOAT;
-    attrDescs[1].offset   = offsetof(Vertex, color);
+    desc.bindingDescs.resize(1);
+    desc.bindingDescs[0].binding   = 0;  // Vertex
+    desc.bindingDescs[0].stride    = sizeof(Vertex);
+    desc.bindingDescs[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+    // Attribute Offsets, in the Shader's Location Order
+    desc.attributeOffsets = {
+        static_cast<uint32_t>(offsetof(Vertex, pos)),
+        static_cast<uint32_t>(offsetof(Vertex, color))
+    };
 
     // Layout Description
-    std::vector<VkDescriptorSetLayout> layoutDescs;
-    layoutDescs.insert(
-        layoutDescs.end(),
+    desc.setLayouts.insert(
+        desc.setLayouts.end(),
         m_scene->GetDescriptorSetLayouts().begin(),
         m_scene->GetDescriptorSetLayouts().end()
     );
+
+    // Attachment Formats, Ignored when a Render Pass is Used
+    desc.colorFormats = { m_swapchain->GetFormat() };
+    desc.depthFormat  = m_swapchain->GetDepthFormat();
+    desc.samples      = m_samples;
     
-    // Pipeline
-    auto pipeline = VulkanPipeline::Create(
-        m_context->GetDevice(),
-        *m_swapchain,
-        *m_renderPass,
-        bindingDescs,
-        attrDescs,
-        layoutDescs,
-        FRAMES_IN_FLIGHT
-    );
+    // Pipeline, Attributes are Reflected from the Vertex Shader
+    m_pipelineHandle = m_pipelineLibrary->Add(desc);
+    m_pipelineLibrary->Trim();
+}
 
-    m_pipeline = std::move(pipeline);
+const VulkanPipeline& VulkanRenderer::GetPipeline() const
+{
+    return m_pipelineLibrary->Get(m_pipelineHandle);
 }
 
 VulkanRenderer::VulkanRenderer(VulkanRenderer&& other) noexcept : 
@@ -188,9 +495,24 @@ VulkanRenderer::VulkanRenderer(VulkanRenderer&& other) noexcept :
     m_sync(std::move(other.m_sync)),
     m_commandPool(std::move(other.m_commandPool)),
     m_descriptorPool(std::move(other.m_descriptorPool)),
-    m_pipeline(std::move(other.m_pipeline)),
+    m_transferCommandPool(std::move(other.m_transferCommandPool)),
+    m_pipelineLibrary(std::move(other.m_pipelineLibrary)),
+    m_renderGraph(std::move(other.m_renderGraph)),
+    m_backbuffer(other.m_backbuffer),
+    m_samples(other.m_samples),
+    m_readback(std::move(other.m_readback)),
+    m_readbackCallback(std::move(other.m_readbackCallback)),
+    m_gpuProfiler(std::move(other.m_gpuProfiler)),
+    m_pipelineStatistics(std::move(other.m_pipelineStatistics)),
+    m_pipelineStatisticsEnabled(other.m_pipelineStatisticsEnabled),
     m_scene(std::move(other.m_scene)),
-    m_currentFrame(other.m_currentFrame)
+    m_stats(other.m_stats),
+    m_frameArenas(std::move(other.m_frameArenas)),
+    m_drawList(std::move(other.m_drawList)),
+    m_pipelineHandle(other.m_pipelineHandle),
+    m_currentFrame(other.m_currentFrame),
+    m_frameNumber(other.m_frameNumber),
+    m_isFrameBegun(other.m_isFrameBegun)
 {
     other = VulkanRenderer{};
 }
@@ -206,9 +528,24 @@ VulkanRenderer& VulkanRenderer::operator=(VulkanRenderer &&other) noexcept
         m_sync           = std::move(other.m_sync);
         m_commandPool    = std::move(other.m_commandPool);
         m_descriptorPool = std::move(other.m_descriptorPool);
-        m_pipeline       = std::move(other.m_pipeline);
-        m_scene          = std::move(other.m_scene);
-        m_currentFrame   = other.m_currentFrame;
+        m_transferCommandPool = std::move(other.m_transferCommandPool);
+        m_pipelineLibrary = std::move(other.m_pipelineLibrary);
+        m_renderGraph     = std::move(other.m_renderGraph);
+        m_backbuffer      = other.m_backbuffer;
+        m_samples         = other.m_samples;
+        m_readback        = std::move(other.m_readback);
+        m_readbackCallback = std::move(other.m_readbackCallback);
+        m_gpuProfiler     = std::move(other.m_gpuProfiler);
+        m_pipelineStatistics        = std::move(other.m_pipelineStatistics);
+        m_pipelineStatisticsEnabled = other.m_pipelineStatisticsEnabled;
+        m_stats           = other.m_stats;
+        m_scene           = std::move(other.m_scene);
+        m_frameArenas     = std::move(other.m_frameArenas);
+        m_drawList        = std::move(other.m_drawList);
+        m_pipelineHandle  = other.m_pipelineHandle;
+        m_currentFrame    = other.m_currentFrame;
+        m_frameNumber     = other.m_frameNumber;
+        m_isFrameBegun    = other.m_isFrameBegun;
 
         other = VulkanRenderer{};
     }
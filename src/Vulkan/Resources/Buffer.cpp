@@ -1,11 +1,40 @@
 #include "Vulkan/Resources/Buffer.hpp"
 
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 
 #include "Vulkan/Core/Device.hpp"
 #include "Vulkan/Commands/CommandPool.hpp"
 #include "Vulkan/Resources/MemoryAllocator.hpp"
+#include "Vulkan/Sync/Sync.hpp"
+#include "Vulkan/Sync/BarrierBatch.hpp"
+#include "Vulkan/Sync/Fence.hpp"
+#include "Vulkan/Sync/Semaphore.hpp"
+
+#include "Profiling/CpuProfiler.hpp"
+
+// Upload Targets are Written on the Transfer Queue and Read on Graphics, Shared Rather than Handed Between Families
+// Host-Visible Buffers are Written by the Host or by Graphics Copies, such as Readback, and Stay Exclusive
+static void setSharingMode(
+    const VulkanDevice    &device,
+    VkMemoryPropertyFlags properties,
+    VkBufferCreateInfo    &bufferInfo,
+    uint32_t              (&queueFamilies)[2]
+) {
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    bool isUploadTarget = (bufferInfo.usage & VK_BUFFER_USAGE_TRANSFER_DST_BIT) && !(properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+    if (!isUploadTarget || !device.HasDedicatedTransferQueue())
+        return;
+
+    queueFamilies[0] = device.GetGraphicsQueueFamily();
+    queueFamilies[1] = device.GetTransferQueueFamily();
+
+    bufferInfo.sharingMode           = VK_SHARING_MODE_CONCURRENT;
+    bufferInfo.queueFamilyIndexCount = 2;
+    bufferInfo.pQueueFamilyIndices   = queueFamilies;
+}
 
 VulkanBuffer::VulkanBuffer(
     const VulkanDevice     &device,
@@ -35,7 +64,9 @@ std::unique_ptr<VulkanBuffer> VulkanBuffer::Create(
     VulkanMemoryAllocator      &allocator,
     VkDeviceSize          size,
     VkBufferUsageFlags    usage,
-    VkMemoryPropertyFlags properties
+    VkMemoryPropertyFlags properties,
+    VulkanMemoryCategory  category,
+    uint32_t              frame
 ) {
     VkResult result = VK_SUCCESS;
 
@@ -43,7 +74,9 @@ std::unique_ptr<VulkanBuffer> VulkanBuffer::Create(
     bufferInfo.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     bufferInfo.size        = size;
     bufferInfo.usage       = usage;
-    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    uint32_t queueFamilies[2];
+    setSharingMode(device, properties, bufferInfo, queueFamilies);
     
     // Create Buffer
     VkBuffer handle;
@@ -55,21 +88,31 @@ std::unique_ptr<VulkanBuffer> VulkanBuffer::Create(
         throw std::runtime_error("Failed to Create Buffer.");
     }
 
-    // Query Requirements
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(device.GetHandle(), handle, &memRequirements);
+    // Query Requirements, Including Whether the Driver Wants the Buffer Alone
+    VkMemoryDedicatedRequirements dedicatedRequirements{};
+    dedicatedRequirements.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+
+    VkMemoryRequirements2 memRequirements2{};
+    memRequirements2.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+    memRequirements2.pNext = &dedicatedRequirements;
+
+    VkBufferMemoryRequirementsInfo2 requirementsInfo{};
+    requirementsInfo.sType  = VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2;
+    requirementsInfo.buffer = handle;
+
+    vkGetBufferMemoryRequirements2(device.GetHandle(), &requirementsInfo, &memRequirements2);
+
+    const VkMemoryRequirements &memRequirements = memRequirements2.memoryRequirements;
+
+    bool isDedicated = dedicatedRequirements.prefersDedicatedAllocation || dedicatedRequirements.requiresDedicatedAllocation;
     
     // Allocate and Bind
-    VulkanAllocationHandle allocationHandle = allocator.Allocate(
-        physicalDevice,
-        device,
-        memRequirements.size,
-        memRequirements.memoryTypeBits,
-        properties
-    );
+    VulkanAllocationHandle allocationHandle = isDedicated
+        ? allocator.AllocateDedicated(physicalDevice, device, memRequirements, properties, category, { VK_NULL_HANDLE, handle })
+        : allocator.Allocate(physicalDevice, device, memRequirements, properties, category);
     allocator.BindBuffer(device, handle, allocationHandle);
 
-    return std::unique_ptr<VulkanBuffer>(
+    auto buffer = std::unique_ptr<VulkanBuffer>(
         new VulkanBuffer(
             device,
             allocator,
@@ -80,12 +123,28 @@ std::unique_ptr<VulkanBuffer> VulkanBuffer::Create(
             properties
         )
     );
+
+    // Device-Local Buffers of One Frame that can be Copied Both Ways may be Moved by Defragmentation
+    // Uploads Run on Another Queue, Only the Frame's Fence and Submit Order them Against the Move's Copy
+    constexpr VkBufferUsageFlags relocatableUsage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    if (!isDedicated && frame != UINT32_MAX && !(properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && (usage & relocatableUsage) == relocatableUsage)
+    {
+        PoolHandle<VulkanBuffer> bufferHandle = buffer->GetPoolHandle();
+        allocator.SetRelocateCallback(allocationHandle, frame, [bufferHandle](VulkanAllocationHandle newAllocation) {
+            VulkanBuffer *pBuffer = VulkanBuffer::Resolve(bufferHandle);
+            return pBuffer ? pBuffer->Relocate(newAllocation) : VulkanBufferMove{};
+        });
+    }
+
+    return buffer;
 }
 
 void VulkanBuffer::Update(
     const void   *data,
     VkDeviceSize size
 ) {
+    PROFILE_ZONE("Buffer::Update");
+
     if (size > m_size)
         throw std::runtime_error("Buffer cannot be updated because 'dataSize' is larger than the buffer's size.");
 
@@ -96,21 +155,21 @@ void VulkanBuffer::Update(
     m_allocator.Unmap(m_device, m_allocationHandle);
 }
 
-void VulkanBuffer::CopyTo(
+uint64_t VulkanBuffer::CopyTo(
     const VulkanCommandPool &commandPool,
-    const VulkanBuffer      &dst
+    VulkanSync              &sync,
+    const VulkanBuffer      &dst,
+    uint32_t                currentFrame
 ) {
+    PROFILE_ZONE("Buffer::CopyTo");
+
     if (dst.GetSize() < m_size)
         throw std::runtime_error("Buffer cannot be copied because the original buffer's size is smaller than 'dst.size'.");
 
-    VkCommandBufferAllocateInfo allocInfo{};
-    allocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    allocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    allocInfo.commandPool        = commandPool.GetHandle();
-    allocInfo.commandBufferCount = 1;
+    VkResult result = VK_SUCCESS;
 
-    VkCommandBuffer commandBuffer;
-    vkAllocateCommandBuffers(m_device.GetHandle(), &allocInfo, &commandBuffer);
+    // Recycled, Begin Resets it
+    VkCommandBuffer commandBuffer = sync.AcquireCommandBuffer(commandPool);
 
     VkCommandBufferBeginInfo beginInfo{};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -130,19 +189,92 @@ void VulkanBuffer::CopyTo(
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &commandBuffer;
 
-    vkQueueSubmit(m_device.GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(m_device.GetGraphicsQueue());
+    // The Frame's Next Submit Waits on this, so the Copy's Writes Reach the Graphics Queue
+    VulkanSemaphore *copied       = sync.AcquireSemaphore();
+    VkSemaphore      copiedHandle = copied->GetHandle();
+
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores    = &copiedHandle;
+
+    // Transfer Pools Submit to the Copy Engine, which Runs Beside the Frames Already in Flight
+    VkQueue queue = commandPool.GetQueueFamily() == m_device.GetTransferQueueFamily()
+        ? m_device.GetTransferQueue()
+        : m_device.GetGraphicsQueue();
+
+    // Signals when the Copy is Done, Polled by WaitForFence Rather than Waited On Here
+    VulkanFence *fence = sync.AcquireFence();
+    {
+        PROFILE_ZONE("QueueSubmit");
+        result = vkQueueSubmit(queue, 1, &submitInfo, fence->GetHandle());
+    }
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "[ERROR]\t'vkQueueSubmit' Failed with Error Code " << result << "\n";
+
+        throw std::runtime_error("Failed to Submit Buffer Copy.");
+    }
+
+    // Only the Stages that Touch the Destination Wait, Vertex Input for Meshes and Transfer for Defragmentation's Copies
+    VkPipelineStageFlags waitStages = static_cast<VkPipelineStageFlags>(
+        VulkanBarrierBatch::GetBufferSync(dst.GetUsage(), false).stages
+    );
+    sync.AddFrameWait(currentFrame, copied, waitStages != 0 ? waitStages : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT));
+
+    return sync.TrackUpload(commandPool, commandBuffer, fence);
+}
+
+VulkanBufferMove VulkanBuffer::Relocate(VulkanAllocationHandle newAllocation)
+{
+    VkResult result = VK_SUCCESS;
+
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size        = m_size;
+    bufferInfo.usage       = m_usage;
+
+    uint32_t queueFamilies[2];
+    setSharingMode(m_device, m_properties, bufferInfo, queueFamilies);
+
+    VkBuffer handle;
+    result = vkCreateBuffer(m_device.GetHandle(), &bufferInfo, nullptr, &handle);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "[ERROR]\t'vkCreateBuffer' Failed with Error Code " << result << "\n";
+
+        throw std::runtime_error("Failed to Create Buffer.");
+    }
+    m_allocator.BindBuffer(m_device, handle, newAllocation);
+
+    VulkanBufferMove move{};
+    move.src   = m_handle;
+    move.dst   = handle;
+    move.size  = m_size;
+    move.usage = m_usage;
+
+    // Frames in Flight and the Copy Itself Still Read the Old Buffer
+    VkDevice device    = m_device.GetHandle();
+    VkBuffer oldHandle = m_handle;
+    m_allocator.DeferDestroy([device, oldHandle]() {
+        vkDestroyBuffer(device, oldHandle, nullptr);
+    });
+
+    // The Old Allocation was Retired by the Allocator
+    m_handle           = handle;
+    m_allocationHandle = newAllocation;
+
+    if (m_onRelocated)
+        m_onRelocated(*this);
 
-    vkFreeCommandBuffers(m_device.GetHandle(), commandPool.GetHandle(), 1, &commandBuffer);
+    return move;
 }
 
 void VulkanBuffer::Cleanup()
 {
     // Destroy Allocation Handle
-    if (m_allocationHandle != nullptr)
+    if (m_allocationHandle)
     {
         m_allocator.Free(m_device, m_allocationHandle);
-        m_allocationHandle = nullptr;
+        m_allocationHandle = {};
     }
 
     // Destroy Buffer
@@ -163,7 +295,7 @@ VulkanBuffer::VulkanBuffer(VulkanBuffer &&other) noexcept :
     m_properties(other.m_properties)
 {
     other.m_handle           = VK_NULL_HANDLE;
-    other.m_allocationHandle = nullptr;
+    other.m_allocationHandle = {};
     other.m_size             = 0;
     other.m_usage            = 0;
     other.m_properties       = 0;
@@ -182,7 +314,7 @@ VulkanBuffer& VulkanBuffer::operator=(VulkanBuffer &&other) noexcept
         m_properties         = other.m_properties;
 
         other.m_handle           = VK_NULL_HANDLE;
-        other.m_allocationHandle = nullptr;
+        other.m_allocationHandle = {};
         other.m_size             = 0;
         other.m_usage            = 0;
         other.m_properties       = 0;
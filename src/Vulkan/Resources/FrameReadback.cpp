@@ -0,0 +1,214 @@
+#include "Vulkan/Resources/FrameReadback.hpp"
+
+#include <iostream>
+#include <stdexcept>
+
+#include "Vulkan/Core/Device.hpp"
+#include "Vulkan/Resources/Buffer.hpp"
+#include "Vulkan/Resources/Image.hpp"
+#include "Vulkan/Resources/MemoryAllocator.hpp"
+#include "Vulkan/Sync/BarrierBatch.hpp"
+
+VulkanFrameReadback::VulkanFrameReadback(
+    const VulkanDevice    &device,
+    VulkanMemoryAllocator &allocator,
+    std::vector<Slot>     slots,
+    VkExtent2D extent,
+    VkFormat   format,
+    uint32_t   texelSize
+) : m_device(device),
+    m_allocator(allocator),
+    m_slots(std::move(slots)),
+    m_extent(extent),
+    m_format(format),
+    m_texelSize(texelSize)
+{}
+
+VulkanFrameReadback::~VulkanFrameReadback()
+{
+    Cleanup();
+}
+
+std::unique_ptr<VulkanFrameReadback> VulkanFrameReadback::Create(
+    const VulkanPhysicalDevice &physicalDevice,
+    const VulkanDevice         &device,
+    VulkanMemoryAllocator      &allocator,
+    VkExtent2D extent,
+    VkFormat   format,
+    uint32_t   frameCount
+) {
+    uint32_t     texelSize = GetTexelSize(format);
+    VkDeviceSize size      = static_cast<VkDeviceSize>(extent.width) * extent.height * texelSize;
+
+    // Host Cached Keeps CPU Reads of the Pixels Fast, Falls Back to Coherent
+    std::vector<Slot> slots(frameCount);
+    for (auto &slot : slots)
+    {
+        slot.buffer = VulkanBuffer::Create(
+            physicalDevice,
+            device,
+            allocator,
+            size,
+            VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+            VulkanMemoryCategory::Staging
+        );
+
+        // Persistently Mapped, Unmapped when the Buffer is Freed
+        allocator.Map(device, slot.buffer->GetAllocationHandle());
+    }
+
+    std::cout << "[INFO]\tFrame Readback Created Successfully.\n";
+
+    return std::unique_ptr<VulkanFrameReadback>(
+        new VulkanFrameReadback(
+            device,
+            allocator,
+            std::move(slots),
+            extent,
+            format,
+            texelSize
+        )
+    );
+}
+
+void VulkanFrameReadback::Record(
+    VkCommandBuffer    commandBuffer,
+    const VulkanImage  &image,
+    VkImageLayout      layout,
+    uint32_t           currentFrame,
+    uint64_t           frameNumber,
+    VulkanReadbackCallback callback
+) {
+    if (!(image.GetUsage() & VK_IMAGE_USAGE_TRANSFER_SRC_BIT))
+        throw std::runtime_error("Image cannot be read back because it was not created with 'VK_IMAGE_USAGE_TRANSFER_SRC_BIT'.");
+
+    if (image.GetExtent().width != m_extent.width || image.GetExtent().height != m_extent.height)
+        throw std::runtime_error("Image cannot be read back because its extent does not match the readback's extent.");
+
+    Slot &slot = m_slots[currentFrame];
+
+    // The Slot was Collected when its Fence was Waited On, Anything Left is Stale
+    if (slot.callback)
+        std::cerr << "[WARNING]\tReadback of Frame " << slot.frameNumber << " was Never Collected.\n";
+
+    VulkanBarrierBatch barriers(m_device);
+
+    // Always Recorded, even Already in TRANSFER_SRC, the Copy must Follow the Frame's Color Writes
+    // Stages are Given Rather than Derived, PRESENT_SRC Implies No Access to Chain With
+    VkImageMemoryBarrier2 preCopy{};
+    preCopy.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    preCopy.srcStageMask        = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+    preCopy.srcAccessMask       = VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT;
+    preCopy.dstStageMask        = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    preCopy.dstAccessMask       = VK_ACCESS_2_TRANSFER_READ_BIT;
+    preCopy.oldLayout           = layout;
+    preCopy.newLayout           = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    preCopy.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    preCopy.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    preCopy.image               = image.GetHandle();
+    preCopy.subresourceRange    = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+    barriers.AddImage(preCopy);
+    barriers.Record(commandBuffer);
+
+    // Copy
+    VkBufferImageCopy region{};
+    region.bufferOffset      = 0;
+    region.bufferRowLength   = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource  = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+    region.imageOffset       = { 0, 0, 0 };
+    region.imageExtent       = { m_extent.width, m_extent.height, 1 };
+
+    vkCmdCopyImageToBuffer(
+        commandBuffer,
+        image.GetHandle(),
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        slot.buffer->GetHandle(),
+        1, &region
+    );
+
+    // Transfer Writes are Made Available to the Host before the Fence Signals
+    barriers.AddBuffer(
+        *slot.buffer,
+        VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT,
+        VK_ACCESS_2_TRANSFER_WRITE_BIT,
+        VK_PIPELINE_STAGE_2_HOST_BIT,
+        VK_ACCESS_2_HOST_READ_BIT
+    );
+
+    if (layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
+        barriers.AddImage(image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, layout, VK_IMAGE_ASPECT_COLOR_BIT);
+
+    barriers.Record(commandBuffer);
+
+    slot.frameNumber = frameNumber;
+    slot.callback    = std::move(callback);
+}
+
+void VulkanFrameReadback::Collect(uint32_t currentFrame)
+{
+    Slot &slot = m_slots[currentFrame];
+
+    if (!slot.callback)
+        return;
+
+    m_allocator.Invalidate(m_device, slot.buffer->GetAllocationHandle());
+
+    VulkanReadbackFrame frame{};
+    frame.frameNumber = slot.frameNumber;
+    frame.extent      = m_extent;
+    frame.format      = m_format;
+    frame.rowPitch    = m_extent.width * m_texelSize;
+    frame.data        = static_cast<const uint8_t*>(m_allocator.Map(m_device, slot.buffer->GetAllocationHandle()));
+    frame.size        = static_cast<size_t>(slot.buffer->GetSize());
+
+    // Cleared First so the Callback can Queue Another Readback
+    VulkanReadbackCallback callback = std::move(slot.callback);
+    slot.callback = nullptr;
+
+    callback(frame);
+}
+
+void VulkanFrameReadback::CollectAll()
+{
+    // Oldest Frame First
+    uint32_t oldest = 0;
+    for (uint32_t i = 1; i < m_slots.size(); ++i)
+    {
+        if (m_slots[i].frameNumber < m_slots[oldest].frameNumber)
+            oldest = i;
+    }
+
+    for (uint32_t i = 0; i < m_slots.size(); ++i)
+        Collect((oldest + i) % static_cast<uint32_t>(m_slots.size()));
+}
+
+uint32_t VulkanFrameReadback::GetTexelSize(VkFormat format)
+{
+    switch (format)
+    {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+        case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+        case VK_FORMAT_A2R10G10B10_UNORM_PACK32:
+            return 4;
+
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+            return 8;
+
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            return 16;
+
+        default:
+            throw std::runtime_error("Format cannot be read back, its texel size is unknown.");
+    }
+}
+
+void VulkanFrameReadback::Cleanup()
+{
+    m_slots.clear();
+}
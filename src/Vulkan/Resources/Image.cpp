@@ -6,6 +6,7 @@
 
 #include "Vulkan/Core/Device.hpp"
 #include "Vulkan/Resources/MemoryAllocator.hpp"
+#include "Vulkan/Sync/BarrierBatch.hpp"
 
 VulkanImage::VulkanImage(
     const VulkanDevice    &device,
@@ -23,6 +24,7 @@ VulkanImage::VulkanImage(
 ) : m_device(device),
     m_allocator(allocator),
     m_handle(handle),
+    m_allocationHandle(allocationHandle),
     m_extent(extent),
     m_format(format),
     m_mipLevels(mipLevels),
@@ -52,7 +54,7 @@ std::unique_ptr<VulkanImage> VulkanImage::Create(
     VkImage               externalHandle
 ) {
     VkImage                handle           = VK_NULL_HANDLE;
-    VulkanAllocationHandle allocationHandle = nullptr;
+    VulkanAllocationHandle allocationHandle = {};
 
     bool isSwapchainImage = false;
 
@@ -88,22 +90,29 @@ std::unique_ptr<VulkanImage> VulkanImage::Create(
             throw std::runtime_error("Failed to Create Image.");
         }
 
-        // Query Requirements
-        VkMemoryRequirements memRequirements;
-        vkGetImageMemoryRequirements(
-            device.GetHandle(), 
-            handle,
-            &memRequirements
-        );
+        // Query Requirements, Including Whether the Driver Wants the Image Alone
+        VkMemoryDedicatedRequirements dedicatedRequirements{};
+        dedicatedRequirements.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+
+        VkMemoryRequirements2 memRequirements2{};
+        memRequirements2.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+        memRequirements2.pNext = &dedicatedRequirements;
+
+        VkImageMemoryRequirementsInfo2 requirementsInfo{};
+        requirementsInfo.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2;
+        requirementsInfo.image = handle;
+
+        vkGetImageMemoryRequirements2(device.GetHandle(), &requirementsInfo, &memRequirements2);
+
+        const VkMemoryRequirements &memRequirements = memRequirements2.memoryRequirements;
+
+        // Render Targets are Usually Preferred Dedicated, Sampled Textures go to the Pools
+        bool isDedicated = dedicatedRequirements.prefersDedicatedAllocation || dedicatedRequirements.requiresDedicatedAllocation;
 
         // Allocate and Bind
-        allocationHandle = allocator.Allocate(
-            physicalDevice,
-            device,
-            memRequirements.size,
-            memRequirements.memoryTypeBits,
-            properties
-        );
+        allocationHandle = isDedicated
+            ? allocator.AllocateDedicated(physicalDevice, device, memRequirements, properties, VulkanMemoryCategory::Image, { handle, VK_NULL_HANDLE })
+            : allocator.Allocate(physicalDevice, device, memRequirements, properties, VulkanMemoryCategory::Image);
         allocator.BindImage(device, handle, allocationHandle);
     }
 
@@ -125,21 +134,87 @@ std::unique_ptr<VulkanImage> VulkanImage::Create(
     );
 }
 
-void VulkanImage::Cleanup()
-{
-    // Destroy Allocation Handle
-    if (m_allocationHandle != VK_NULL_HANDLE)
+std::unique_ptr<VulkanImage> VulkanImage::CreateAliased(
+    const VulkanDevice    &device,
+    VulkanMemoryAllocator &allocator,
+    VkExtent3D        extent,
+    VkFormat          format,
+    VkImageUsageFlags usage,
+    VkSampleCountFlagBits samples
+) {
+    VkResult result = VK_SUCCESS;
+
+    // Image Create Info
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType     = VK_IMAGE_TYPE_2D;
+    imageInfo.format        = format;
+    imageInfo.extent        = extent;
+    imageInfo.mipLevels     = 1;
+    imageInfo.arrayLayers   = 1;
+    imageInfo.samples       = samples;
+    imageInfo.tiling        = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage         = usage;
+    imageInfo.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    // Create Image
+    VkImage handle = VK_NULL_HANDLE;
+    result = vkCreateImage(device.GetHandle(), &imageInfo, nullptr, &handle);
+    if (result != VK_SUCCESS)
     {
-        m_allocator.Free(m_device, m_allocationHandle);
-        m_allocationHandle = nullptr;
+        std::cerr << "[ERROR]\t'vkCreateImage' Failed with Error Code " << result << "\n";
+
+        throw std::runtime_error("Failed to Create Image.");
     }
 
+    return std::unique_ptr<VulkanImage>(
+        new VulkanImage(
+            device,
+            allocator,
+            handle,
+            {},
+            extent,
+            format,
+            1,
+            1,
+            VK_IMAGE_TILING_OPTIMAL,
+            usage,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            false
+        )
+    );
+}
+
+VkMemoryRequirements VulkanImage::GetMemoryRequirements() const
+{
+    VkMemoryRequirements memRequirements;
+    vkGetImageMemoryRequirements(m_device.GetHandle(), m_handle, &memRequirements);
+
+    return memRequirements;
+}
+
+void VulkanImage::BindMemory(VulkanAllocationHandle allocationHandle)
+{
+    // Not Owned, the Allocation may be Shared with Other Images
+    m_allocator.BindImage(m_device, m_handle, allocationHandle);
+}
+
+void VulkanImage::Cleanup()
+{
     // Destroy Image Handle
     if (!m_isSwapchainImage && m_handle != VK_NULL_HANDLE)
     {
         vkDestroyImage(m_device.GetHandle(), m_handle, nullptr);
     }
     m_handle = VK_NULL_HANDLE;
+
+    // Destroy Allocation Handle, after the Image Bound to It
+    if (m_allocationHandle)
+    {
+        m_allocator.Free(m_device, m_allocationHandle);
+        m_allocationHandle = {};
+    }
 }
 
 void VulkanImage::TransitionLayout(
@@ -150,30 +225,10 @@ void VulkanImage::TransitionLayout(
     uint32_t mipLevels,
     uint32_t arrayLayers
 ) {
-    VkImageMemoryBarrier barrier{};
-    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-    barrier.oldLayout = oldLayout;
-    barrier.newLayout = newLayout;
-    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.image = m_handle;
-    barrier.subresourceRange.aspectMask = aspectMask;
-    barrier.subresourceRange.baseMipLevel = 0;
-    barrier.subresourceRange.levelCount = mipLevels;
-    barrier.subresourceRange.baseArrayLayer = 0;
-    barrier.subresourceRange.layerCount = arrayLayers;
-    
-    VkPipelineStageFlags srcStage  = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-    VkPipelineStageFlags destStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-
-    vkCmdPipelineBarrier(
-        commandBuffer,
-        srcStage, destStage,
-        0,
-        0, nullptr,
-        0, nullptr,
-        1, &barrier
-    );
+    // Stages and Access Follow from the Layouts instead of Draining the Pipeline
+    VulkanBarrierBatch batch(m_device);
+    batch.AddImage(*this, oldLayout, newLayout, aspectMask, mipLevels, arrayLayers);
+    batch.Record(commandBuffer);
 }
 
 VulkanImage::VulkanImage(VulkanImage &&other) noexcept : 
@@ -190,7 +245,7 @@ VulkanImage::VulkanImage(VulkanImage &&other) noexcept :
     m_properties(other.m_properties)
 {
     other.m_handle           = VK_NULL_HANDLE;
-    other.m_allocationHandle = nullptr;
+    other.m_allocationHandle = {};
     other.m_extent           = VkExtent3D{0, 0, 0};
     other.m_format           = VK_FORMAT_UNDEFINED;
     other.m_mipLevels        = 1;
@@ -217,7 +272,7 @@ VulkanImage& VulkanImage::operator=(VulkanImage &&other) noexcept
         m_properties         = other.m_properties;
 
         other.m_handle           = VK_NULL_HANDLE;
-        other.m_allocationHandle = nullptr;
+        other.m_allocationHandle = {};
         other.m_extent           = VkExtent3D{0, 0, 0};
         other.m_format           = VK_FORMAT_UNDEFINED;
         other.m_mipLevels        = 1;
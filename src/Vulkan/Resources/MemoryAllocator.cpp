@@ -2,18 +2,178 @@
 
 #include "Vulkan/Core/Device.hpp"
 #include "Vulkan/Core/PhysicalDevice.hpp"
+#include "Vulkan/Sync/BarrierBatch.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <iomanip>
 #include <iostream>
 #include <stdexcept>
 
+#include "Settings.hpp"
+
 struct VulkanMemoryAllocation
 {
     VkDeviceMemory memory = VK_NULL_HANDLE;
     VkDeviceSize   offset = 0;
     VkDeviceSize   size   = 0;
+    VkDeviceSize   alignment = 1;
     void* pMappedData     = nullptr;
+
+    uint32_t             memoryTypeIndex = 0;
+    VulkanMemoryCategory category        = VulkanMemoryCategory::Other;
+
+    VulkanMemoryBlock *block = nullptr;
+
+    // Set when the Owner can be Moved, Cleared once Moved Away
+    VulkanRelocateCallback relocate;
+    uint32_t               frame     = UINT32_MAX;
+    bool                   isRetired = false;
 };
 
+// One Device Memory Object, Handed Out in Aligned Ranges
+struct VulkanMemoryBlock
+{
+    struct Range
+    {
+        VkDeviceSize offset = 0;
+        VkDeviceSize size   = 0;
+    };
+
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize   size   = 0;
+
+    uint32_t memoryTypeIndex = 0;
+    bool     isOptimal       = false;
+    bool     isDedicated     = false;
+
+    // Sorted by Offset, Neighbours are Always Merged
+    std::vector<Range>                   freeRanges;
+    std::vector<VulkanMemoryAllocation*> allocations;
+    VkDeviceSize                         usedBytes = 0;
+
+    // Mapped Whole while Any Allocation is Mapped, Memory can Only be Mapped Once
+    void*    pMappedData = nullptr;
+    uint32_t mapCount    = 0;
+};
+
+static VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// First Fit, Returns Null when No Free Range Holds the Aligned Size
+static VulkanMemoryAllocation* allocateFromBlock(
+    Pool<VulkanMemoryAllocation> &allocations,
+    VulkanMemoryBlock            &block,
+    VkDeviceSize size,
+    VkDeviceSize alignment
+) {
+    for (size_t i = 0; i < block.freeRanges.size(); ++i)
+    {
+        VulkanMemoryBlock::Range range = block.freeRanges[i];
+
+        VkDeviceSize offset  = alignUp(range.offset, alignment);
+        VkDeviceSize padding = offset - range.offset;
+        if (padding + size > range.size)
+            continue;
+
+        // Padding Stays Free in Front, the Remainder Behind
+        block.freeRanges.erase(block.freeRanges.begin() + i);
+        if (range.offset + range.size > offset + size)
+            block.freeRanges.insert(block.freeRanges.begin() + i, { offset + size, range.offset + range.size - offset - size });
+        if (padding > 0)
+            block.freeRanges.insert(block.freeRanges.begin() + i, { range.offset, padding });
+
+        VulkanMemoryAllocation *allocation = allocations.Get(allocations.Create());
+        allocation->memory          = block.memory;
+        allocation->offset          = offset;
+        allocation->size            = size;
+        allocation->alignment       = alignment;
+        allocation->memoryTypeIndex = block.memoryTypeIndex;
+        allocation->block           = &block;
+
+        block.allocations.push_back(allocation);
+        block.usedBytes += size;
+
+        return allocation;
+    }
+
+    return nullptr;
+}
+
+static void freeFromBlock(VulkanMemoryBlock &block, VulkanMemoryAllocation *allocation)
+{
+    block.allocations.erase(std::find(block.allocations.begin(), block.allocations.end(), allocation));
+    block.usedBytes -= allocation->size;
+
+    auto it = std::lower_bound(
+        block.freeRanges.begin(),
+        block.freeRanges.end(),
+        allocation->offset,
+        [](const VulkanMemoryBlock::Range &range, VkDeviceSize offset) { return range.offset < offset; }
+    );
+    it = block.freeRanges.insert(it, { allocation->offset, allocation->size });
+
+    // Merge with the Next, then the Previous Range
+    auto next = it + 1;
+    if (next != block.freeRanges.end() && it->offset + it->size == next->offset)
+    {
+        it->size += next->size;
+        block.freeRanges.erase(next);
+    }
+    if (it != block.freeRanges.begin())
+    {
+        auto previous = it - 1;
+        if (previous->offset + previous->size == it->offset)
+        {
+            previous->size += it->size;
+            block.freeRanges.erase(it);
+        }
+    }
+}
+
+VulkanMemoryPreference getMemoryPreference(VkMemoryPropertyFlags properties, VulkanMemoryCategory category)
+{
+    constexpr VkMemoryPropertyFlags optional = VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+
+    VulkanMemoryPreference preference{};
+    preference.required  = properties & ~optional;
+    preference.preferred = properties &  optional;
+
+    bool isDeviceLocal = properties & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    bool isHostVisible = properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+
+    // GPU-Only Memory Stays Out of the Small Host-Visible BAR Heap
+    if (isDeviceLocal && !isHostVisible)
+        preference.notPreferred |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+
+    if (isHostVisible && !isDeviceLocal)
+    {
+        // Written by the CPU, Read by Shaders Every Frame, VRAM Helps when the Host can Reach It
+        if (category == VulkanMemoryCategory::Uniform)
+            preference.preferred |= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+        // Only Read by Transfers, Belongs in System Memory on Discrete GPUs
+        else
+            preference.notPreferred |= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    }
+
+    return preference;
+}
+
+const char* getMemoryCategoryName(VulkanMemoryCategory category)
+{
+    switch (category)
+    {
+        case VulkanMemoryCategory::Mesh:    return "mesh";
+        case VulkanMemoryCategory::Staging: return "staging";
+        case VulkanMemoryCategory::Uniform: return "uniform";
+        case VulkanMemoryCategory::Image:   return "image";
+        default:                            return "other";
+    }
+}
+
 VulkanMemoryAllocator::~VulkanMemoryAllocator() = default;
 
 std::unique_ptr<VulkanMemoryAllocator> VulkanMemoryAllocator::Create()
@@ -27,41 +187,190 @@ void VulkanMemoryAllocator::Free(
     const VulkanDevice     &device,
     VulkanAllocationHandle allocationHandle
 ) {
-    VulkanMemoryAllocation* allocation = static_cast<VulkanMemoryAllocation*>(allocationHandle);
+    VulkanMemoryAllocation* allocation = m_allocations.Get(allocationHandle);
 
     if (allocation == nullptr) return;
     
     if (allocation->pMappedData != nullptr) {
-        Unmap(device, allocation);
+        Unmap(device, allocationHandle);
         allocation->pMappedData = nullptr;
     }
 
-    if (allocation->memory != VK_NULL_HANDLE) {
-        vkFreeMemory(device.GetHandle(), allocation->memory, nullptr);
-        allocation->memory = VK_NULL_HANDLE;
+    VulkanMemoryBlock *block = allocation->block;
+    if (block != nullptr) {
+        freeFromBlock(*block, allocation);
+
+        TrackAllocation(allocation->memoryTypeIndex, allocation->category, allocation->size, true);
+
+        // Empty Blocks are Returned to the Driver Right Away
+        if (block->allocations.empty())
+            FreeBlock(device, block);
     }
     
-    delete allocation;
+    m_allocations.Destroy(allocationHandle);
 }
 
 VulkanAllocationHandle VulkanMemoryAllocator::Allocate(
     const VulkanPhysicalDevice &physicalDevice,
     const VulkanDevice         &device,
-    VkDeviceSize          size,
-    uint32_t              memoryTypeBits,
-    VkMemoryPropertyFlags properties
+    const VkMemoryRequirements &requirements,
+    VkMemoryPropertyFlags properties,
+    VulkanMemoryCategory  category
+) {
+    return AllocateFromTypes(physicalDevice, device, requirements, properties, category, nullptr);
+}
+
+VulkanAllocationHandle VulkanMemoryAllocator::AllocateDedicated(
+    const VulkanPhysicalDevice    &physicalDevice,
+    const VulkanDevice            &device,
+    const VkMemoryRequirements    &requirements,
+    VkMemoryPropertyFlags         properties,
+    VulkanMemoryCategory          category,
+    const VulkanDedicatedResource &resource
+) {
+    return AllocateFromTypes(physicalDevice, device, requirements, properties, category, &resource);
+}
+
+bool VulkanMemoryAllocator::SupportsDirectDeviceWrites(const VulkanPhysicalDevice &physicalDevice)
+{
+    LoadDeviceProperties(physicalDevice);
+
+    constexpr VkMemoryPropertyFlags direct =
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++)
+    {
+        const VkMemoryType &type = m_memoryProperties.memoryTypes[i];
+
+        if ((type.propertyFlags & direct) == direct &&
+            m_memoryProperties.memoryHeaps[type.heapIndex].size > DIRECT_WRITE_MIN_HEAP_SIZE)
+            return true;
+    }
+
+    return false;
+}
+
+VulkanAllocationHandle VulkanMemoryAllocator::AllocateFromTypes(
+    const VulkanPhysicalDevice    &physicalDevice,
+    const VulkanDevice            &device,
+    const VkMemoryRequirements    &requirements,
+    VkMemoryPropertyFlags         properties,
+    VulkanMemoryCategory          category,
+    const VulkanDedicatedResource *pResource
+) {
+    LoadDeviceProperties(physicalDevice);
+
+    std::vector<uint32_t> memoryTypes = FindMemoryTypes(
+        requirements.memoryTypeBits,
+        getMemoryPreference(properties, category),
+        requirements.size
+    );
+    if (memoryTypes.empty())
+        throw std::runtime_error("Failed to Find Suitable Memory Type.");
+
+    // Images are Kept Apart so bufferImageGranularity Never Applies
+    bool isOptimal = category == VulkanMemoryCategory::Image;
+
+    for (uint32_t memoryTypeIndex : memoryTypes)
+    {
+        VulkanMemoryAllocation *allocation = AllocateInType(device, memoryTypeIndex, requirements, isOptimal, pResource);
+        if (!allocation)
+        {
+            std::cerr << "[WARNING]\tMemory Type " << memoryTypeIndex << " is Out of Device Memory, Trying the Next Best Type.\n";
+            continue;
+        }
+
+        allocation->category = category;
+        TrackAllocation(memoryTypeIndex, category, allocation->size, false);
+
+        return m_allocations.GetHandle(allocation);
+    }
+
+    std::cerr << "[ERROR]\t'vkAllocateMemory' Failed with Error Code " << VK_ERROR_OUT_OF_DEVICE_MEMORY << "\n";
+
+    throw std::runtime_error("Failed to Allocate Memory.");
+}
+
+VulkanMemoryAllocation* VulkanMemoryAllocator::AllocateInType(
+    const VulkanDevice            &device,
+    uint32_t                      memoryTypeIndex,
+    const VkMemoryRequirements    &requirements,
+    bool                          isOptimal,
+    const VulkanDedicatedResource *pResource
+) {
+    VkDeviceSize blockSize = GetBlockSize(memoryTypeIndex);
+
+    // Dedicated Resources and Anything Larger than Half a Block Get their Own
+    if (pResource || requirements.size > blockSize / 2)
+    {
+        VulkanMemoryBlock *block = CreateBlock(device, memoryTypeIndex, requirements.size, isOptimal, true, pResource);
+        return block ? allocateFromBlock(m_allocations, *block, requirements.size, requirements.alignment) : nullptr;
+    }
+
+    for (auto &block : GetPool(memoryTypeIndex, isOptimal))
+    {
+        if (block->isDedicated)
+            continue;
+
+        VulkanMemoryAllocation *allocation = allocateFromBlock(m_allocations, *block, requirements.size, requirements.alignment);
+        if (allocation)
+            return allocation;
+    }
+
+    // A Nearly Full Heap may Still Hold the Request Alone
+    VulkanMemoryBlock *block = CreateBlock(device, memoryTypeIndex, blockSize, isOptimal, false);
+    if (!block)
+        block = CreateBlock(device, memoryTypeIndex, requirements.size, isOptimal, true);
+
+    return block ? allocateFromBlock(m_allocations, *block, requirements.size, requirements.alignment) : nullptr;
+}
+
+void VulkanMemoryAllocator::LoadDeviceProperties(const VulkanPhysicalDevice &physicalDevice)
+{
+    // Heap Layout for Selection, Accounting and Block Sizes, Refreshed by UpdateBudget
+    if (m_physicalDevice == physicalDevice.GetHandle())
+        return;
+
+    m_physicalDevice = physicalDevice.GetHandle();
+    vkGetPhysicalDeviceMemoryProperties(m_physicalDevice, &m_memoryProperties);
+
+    VkPhysicalDeviceProperties deviceProperties;
+    vkGetPhysicalDeviceProperties(m_physicalDevice, &deviceProperties);
+    m_nonCoherentAtomSize = deviceProperties.limits.nonCoherentAtomSize;
+}
+
+VulkanMemoryBlock* VulkanMemoryAllocator::CreateBlock(
+    const VulkanDevice &device,
+    uint32_t     memoryTypeIndex,
+    VkDeviceSize size,
+    bool         isOptimal,
+    bool         isDedicated,
+    const VulkanDedicatedResource *pResource
 ) {
     VkResult result = VK_SUCCESS;
-    
-    uint32_t memoryTypeIndex = FindMemoryType(physicalDevice, memoryTypeBits, properties);
 
     VkMemoryAllocateInfo allocInfo{};
     allocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     allocInfo.allocationSize  = size;
     allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+    // Core Since 1.1, Lets the Driver Place the Resource as it Likes
+    VkMemoryDedicatedAllocateInfo dedicatedInfo{};
+    if (pResource)
+    {
+        dedicatedInfo.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+        dedicatedInfo.image  = pResource->image;
+        dedicatedInfo.buffer = pResource->buffer;
+
+        allocInfo.pNext = &dedicatedInfo;
+    }
     
     VkDeviceMemory memory = VK_NULL_HANDLE;
     result = vkAllocateMemory(device.GetHandle(), &allocInfo, nullptr, &memory);
+    if (result == VK_ERROR_OUT_OF_DEVICE_MEMORY)
+        return nullptr;
     if (result != VK_SUCCESS)
     {
         std::cerr << "[ERROR]\t'vkAllocateMemory' Failed with Error Code " << result << "\n";
@@ -69,61 +378,137 @@ VulkanAllocationHandle VulkanMemoryAllocator::Allocate(
         throw std::runtime_error("Failed to Allocate Memory.");
     }
 
-    VulkanMemoryAllocation* allocation = new VulkanMemoryAllocation{};
-    allocation->memory = memory;
-    allocation->size   = size;
-    allocation->offset = 0;
+    auto block = std::make_unique<VulkanMemoryBlock>();
+    block->memory          = memory;
+    block->size            = size;
+    block->memoryTypeIndex = memoryTypeIndex;
+    block->isOptimal       = isOptimal;
+    block->isDedicated     = isDedicated;
+    block->freeRanges      = { { 0, size } };
+
+    TrackBlock(memoryTypeIndex, size, false);
 
-    return static_cast<VulkanAllocationHandle>(allocation);
+    auto &pool = GetPool(memoryTypeIndex, isOptimal);
+    pool.push_back(std::move(block));
+
+    return pool.back().get();
+}
+
+void VulkanMemoryAllocator::FreeBlock(const VulkanDevice &device, VulkanMemoryBlock *block)
+{
+    if (block->pMappedData != nullptr)
+        vkUnmapMemory(device.GetHandle(), block->memory);
+
+    vkFreeMemory(device.GetHandle(), block->memory, nullptr);
+
+    TrackBlock(block->memoryTypeIndex, block->size, true);
+
+    auto &pool = GetPool(block->memoryTypeIndex, block->isOptimal);
+    pool.erase(std::find_if(
+        pool.begin(),
+        pool.end(),
+        [block](const auto &candidate) { return candidate.get() == block; }
+    ));
+}
+
+VkDeviceSize VulkanMemoryAllocator::GetBlockSize(uint32_t memoryTypeIndex) const
+{
+    // Small Heaps, such as a 256 MiB BAR, Would be Exhausted by a Few Full Blocks
+    VkDeviceSize heapSize = m_memoryProperties.memoryHeaps[m_memoryProperties.memoryTypes[memoryTypeIndex].heapIndex].size;
+
+    return std::min<VkDeviceSize>(MEMORY_BLOCK_SIZE, heapSize / 8);
+}
+
+std::vector<std::unique_ptr<VulkanMemoryBlock>>& VulkanMemoryAllocator::GetPool(uint32_t memoryTypeIndex, bool isOptimal)
+{
+    return m_pools[memoryTypeIndex * 2 + (isOptimal ? 1 : 0)];
 }
 
 void* VulkanMemoryAllocator::Map(
     const VulkanDevice     &device,
     VulkanAllocationHandle allocationHandle
 ) {
-    VulkanMemoryAllocation* allocation = static_cast<VulkanMemoryAllocation*>(allocationHandle);
+    VulkanMemoryAllocation* allocation = m_allocations.Get(allocationHandle);
 
     if (allocation == nullptr) return nullptr;
     
     if (allocation->pMappedData)
         return allocation->pMappedData;
 
-    VkResult result = VK_SUCCESS;
+    VulkanMemoryBlock *block = allocation->block;
 
-    void* hostData = nullptr;
-    
-    result = vkMapMemory(
-        device.GetHandle(),
-        allocation->memory,
-        allocation->offset,
-        allocation->size,
-        0,
-        &hostData
-    );
-    if (result != VK_SUCCESS)
+    if (block->pMappedData == nullptr)
     {
-        std::cerr << "[ERROR]\t'vkMapMemory' Failed with Error Code " << result << "\n";
+        VkResult result = VK_SUCCESS;
+
+        result = vkMapMemory(
+            device.GetHandle(),
+            block->memory,
+            0,
+            VK_WHOLE_SIZE,
+            0,
+            &block->pMappedData
+        );
+        if (result != VK_SUCCESS)
+        {
+            std::cerr << "[ERROR]\t'vkMapMemory' Failed with Error Code " << result << "\n";
 
-        throw std::runtime_error("Failed to Map Memory.");
+            throw std::runtime_error("Failed to Map Memory.");
+        }
     }
 
-    allocation->pMappedData = hostData;
+    block->mapCount++;
+    allocation->pMappedData = static_cast<char*>(block->pMappedData) + allocation->offset;
     
-    return hostData;
+    return allocation->pMappedData;
 }
 
 void VulkanMemoryAllocator::Unmap(
     const VulkanDevice     &device,
     VulkanAllocationHandle allocationHandle
 ) {
-    VulkanMemoryAllocation* allocation = static_cast<VulkanMemoryAllocation*>(allocationHandle);
+    VulkanMemoryAllocation* allocation = m_allocations.Get(allocationHandle);
 
     if (allocation              == nullptr) return;
     if (allocation->pMappedData == nullptr) return;
 
-    vkUnmapMemory(device.GetHandle(), allocation->memory);
-
     allocation->pMappedData = nullptr;
+
+    // The Block Stays Mapped Until its Last Mapped Allocation Lets Go
+    VulkanMemoryBlock *block = allocation->block;
+    if (--block->mapCount == 0)
+    {
+        vkUnmapMemory(device.GetHandle(), block->memory);
+        block->pMappedData = nullptr;
+    }
+}
+
+void VulkanMemoryAllocator::Invalidate(
+    const VulkanDevice     &device,
+    VulkanAllocationHandle allocationHandle
+) {
+    VulkanMemoryAllocation* allocation = m_allocations.Get(allocationHandle);
+
+    if (allocation              == nullptr) return;
+    if (allocation->pMappedData == nullptr) return;
+
+    // Ranges must be Aligned to nonCoherentAtomSize or Reach the End of the Block
+    VkDeviceSize begin = allocation->offset / m_nonCoherentAtomSize * m_nonCoherentAtomSize;
+    VkDeviceSize end   = alignUp(allocation->offset + allocation->size, m_nonCoherentAtomSize);
+
+    VkMappedMemoryRange range{};
+    range.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.memory = allocation->memory;
+    range.offset = begin;
+    range.size   = end >= allocation->block->size ? VK_WHOLE_SIZE : end - begin;
+
+    VkResult result = vkInvalidateMappedMemoryRanges(device.GetHandle(), 1, &range);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "[ERROR]\t'vkInvalidateMappedMemoryRanges' Failed with Error Code " << result << "\n";
+
+        throw std::runtime_error("Failed to Invalidate Mapped Memory.");
+    }
 }
 
 void VulkanMemoryAllocator::BindBuffer(
@@ -131,7 +516,8 @@ void VulkanMemoryAllocator::BindBuffer(
     VkBuffer               handle, 
     VulkanAllocationHandle allocationHandle
 ) {
-    vkBindBufferMemory(device.GetHandle(), handle, static_cast<VulkanMemoryAllocation*>(allocationHandle)->memory, 0);
+    VulkanMemoryAllocation* allocation = m_allocations.Get(allocationHandle);
+    vkBindBufferMemory(device.GetHandle(), handle, allocation->memory, allocation->offset);
 }
 
 void VulkanMemoryAllocator::BindImage(
@@ -139,24 +525,420 @@ void VulkanMemoryAllocator::BindImage(
     VkImage                handle, 
     VulkanAllocationHandle allocationHandle
 ) {
-    vkBindImageMemory(device.GetHandle(), handle, static_cast<VulkanMemoryAllocation*>(allocationHandle)->memory, 0);
+    VulkanMemoryAllocation* allocation = m_allocations.Get(allocationHandle);
+    vkBindImageMemory(device.GetHandle(), handle, allocation->memory, allocation->offset);
 }
 
-uint32_t VulkanMemoryAllocator::FindMemoryType(
-    const VulkanPhysicalDevice &physicalDevice,
-    uint32_t              typeFilter, 
-    VkMemoryPropertyFlags properties
+void VulkanMemoryAllocator::SetRelocateCallback(VulkanAllocationHandle allocationHandle, uint32_t frame, VulkanRelocateCallback callback)
+{
+    VulkanMemoryAllocation* allocation = m_allocations.Get(allocationHandle);
+
+    if (allocation == nullptr) return;
+
+    allocation->relocate = std::move(callback);
+    allocation->frame    = frame;
+}
+
+VkDeviceSize VulkanMemoryAllocator::Defragment(
+    const VulkanDevice &device,
+    VkCommandBuffer commandBuffer,
+    uint64_t        frameNumber,
+    uint32_t        currentFrame,
+    VkDeviceSize    maxBytes
+) {
+    m_frameNumber = frameNumber;
+
+    // The Frame's Fence Wait Orders its Moves After Earlier Uploads were Read and Before Later Ones Write,
+    // and its Submit Waits on Pending Uploads, Another Frame's Allocations have Neither
+    auto isMovable = [currentFrame](const VulkanMemoryAllocation *allocation) {
+        return allocation->relocate && !allocation->isRetired && allocation->frame == currentFrame;
+    };
+
+    VkDeviceSize movedBytes = 0;
+    m_moves.clear();
+
+    for (auto &pool : m_pools)
+    {
+        if (movedBytes >= maxBytes)
+            break;
+
+        // The Sparsest Shared Block that Still has Something to Move
+        VulkanMemoryBlock *source = nullptr;
+        for (auto &block : pool)
+        {
+            if (block->isDedicated)
+                continue;
+
+            bool hasMovable = std::any_of(block->allocations.begin(), block->allocations.end(), isMovable);
+            if (!hasMovable)
+                continue;
+
+            if (!source || block->usedBytes * source->size < source->usedBytes * block->size)
+                source = block.get();
+        }
+
+        if (!source)
+            continue;
+
+        // Moves Only Add to Other Blocks and Retired Allocations Stay Listed, so the Source List is Stable
+        for (VulkanMemoryAllocation *allocation : source->allocations)
+        {
+            if (movedBytes >= maxBytes)
+                break;
+
+            if (!isMovable(allocation))
+                continue;
+
+            // Only into Blocks that Already Exist, Never Grow the Pool to Shrink It
+            VulkanMemoryAllocation *moved = nullptr;
+            for (auto &block : pool)
+            {
+                if (block.get() == source || block->isDedicated)
+                    continue;
+
+                moved = allocateFromBlock(m_allocations, *block, allocation->size, allocation->alignment);
+                if (moved)
+                    break;
+            }
+
+            // Nowhere Else Fits, the Rest of this Block Stays
+            if (!moved)
+                break;
+
+            moved->category = allocation->category;
+            moved->relocate = std::move(allocation->relocate);
+            moved->frame    = allocation->frame;
+            TrackAllocation(moved->memoryTypeIndex, moved->category, moved->size, false);
+
+            VulkanBufferMove move = moved->relocate(m_allocations.GetHandle(moved));
+            if (move.src != VK_NULL_HANDLE)
+                m_moves.push_back(move);
+
+            // The Old Range is Read by the Copy and Frames in Flight, Freed Later
+            allocation->relocate  = nullptr;
+            allocation->isRetired = true;
+            m_retired.push_back({ frameNumber, m_allocations.GetHandle(allocation), nullptr });
+
+            movedBytes += allocation->size;
+        }
+    }
+
+    if (m_moves.empty())
+        return movedBytes;
+
+    VulkanBarrierBatch before(device);
+    VulkanBarrierBatch after(device);
+
+    for (const auto &move : m_moves)
+    {
+        VulkanLayoutSync writers = VulkanBarrierBatch::GetBufferSync(move.usage, true);
+        VulkanLayoutSync users   = VulkanBarrierBatch::GetBufferSync(move.usage, false);
+
+        // Earlier Writes to the Source Land Before the Copy Reads It
+        before.AddBuffer(
+            move.src, 0, move.size,
+            writers.stages, writers.access,
+            VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_READ_BIT
+        );
+
+        // Later Commands See the Moved Contents
+        after.AddBuffer(
+            move.dst, 0, move.size,
+            VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT,
+            users.stages, users.access
+        );
+    }
+
+    before.Record(commandBuffer);
+
+    for (const auto &move : m_moves)
+    {
+        VkBufferCopy copyRegion{};
+        copyRegion.size = move.size;
+        vkCmdCopyBuffer(commandBuffer, move.src, move.dst, 1, &copyRegion);
+    }
+
+    after.Record(commandBuffer);
+
+    return movedBytes;
+}
+
+void VulkanMemoryAllocator::DeferDestroy(std::function<void()> destroy)
+{
+    m_retired.push_back({ m_frameNumber, {}, std::move(destroy) });
+}
+
+void VulkanMemoryAllocator::CollectRetired(const VulkanDevice &device, uint64_t frameNumber)
+{
+    // A Frame is Done once the Fence of the Frame FRAMES_IN_FLIGHT Later has been Waited On
+    auto isDone = [frameNumber](const RetiredAllocation &retired) {
+        return frameNumber == UINT64_MAX || retired.frameNumber + FRAMES_IN_FLIGHT <= frameNumber;
+    };
+
+    // Compacted in Place, Runs Every Frame
+    size_t pending = 0;
+    for (auto &retired : m_retired)
+    {
+        if (!isDone(retired))
+        {
+            if (&m_retired[pending] != &retired)
+                m_retired[pending] = std::move(retired);
+
+            pending++;
+            continue;
+        }
+
+        if (retired.destroy)
+            retired.destroy();
+        if (retired.allocation)
+            Free(device, retired.allocation);
+    }
+
+    m_retired.resize(pending);
+}
+
+void VulkanMemoryAllocator::UpdateBudget(const VulkanPhysicalDevice &physicalDevice, const VulkanDevice &device)
+{
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties{};
+    budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+    VkPhysicalDeviceMemoryProperties2 memoryProperties{};
+    memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    memoryProperties.pNext = device.IsMemoryBudgetEnabled() ? &budgetProperties : nullptr;
+
+    vkGetPhysicalDeviceMemoryProperties2(physicalDevice.GetHandle(), &memoryProperties);
+    m_memoryProperties = memoryProperties.memoryProperties;
+
+    for (uint32_t i = 0; i < m_memoryProperties.memoryHeapCount; ++i)
+    {
+        if (device.IsMemoryBudgetEnabled())
+        {
+            m_heapBudgets[i] = budgetProperties.heapBudget[i];
+            m_heapUsage[i]   = budgetProperties.heapUsage[i];
+        }
+        else
+        {
+            // Leave Headroom for Other Processes, as Drivers Typically Do
+            m_heapBudgets[i] = m_memoryProperties.memoryHeaps[i].size * 8 / 10;
+            m_heapUsage[i]   = 0;
+
+            for (uint32_t type = 0; type < m_memoryProperties.memoryTypeCount; ++type)
+            {
+                if (m_memoryProperties.memoryTypes[type].heapIndex == i)
+                    m_heapUsage[i] += m_types[type].allocatedBytes;
+            }
+        }
+
+        // Warn once per Crossing
+        bool isOverBudget = m_heapUsage[i] > m_heapBudgets[i];
+        if (isOverBudget && !m_isOverBudget[i])
+        {
+            std::cerr << "[WARNING]\tMemory Heap " << i << " is Over Budget, "
+                      << m_heapUsage[i] << " of " << m_heapBudgets[i] << " Bytes Used.\n";
+        }
+        m_isOverBudget[i] = isOverBudget;
+    }
+}
+
+VulkanMemoryStats VulkanMemoryAllocator::GetStats() const
+{
+    VulkanMemoryStats stats{};
+    stats.heaps.resize(m_memoryProperties.memoryHeapCount);
+    stats.types.resize(m_memoryProperties.memoryTypeCount);
+
+    for (uint32_t i = 0; i < m_memoryProperties.memoryHeapCount; ++i)
+    {
+        stats.heaps[i].size   = m_memoryProperties.memoryHeaps[i].size;
+        stats.heaps[i].flags  = m_memoryProperties.memoryHeaps[i].flags;
+        stats.heaps[i].budget = m_heapBudgets[i];
+        stats.heaps[i].usage  = m_heapUsage[i];
+    }
+
+    for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; ++i)
+    {
+        VulkanMemoryTypeStats &type = stats.types[i];
+        type.flags     = m_memoryProperties.memoryTypes[i].propertyFlags;
+        type.heapIndex = m_memoryProperties.memoryTypes[i].heapIndex;
+        type.allocator = m_types[i];
+
+        VulkanMemoryUsage &heap = stats.heaps[type.heapIndex].allocator;
+        heap.allocatedBytes  += m_types[i].allocatedBytes;
+        heap.usedBytes       += m_types[i].usedBytes;
+        heap.allocationCount += m_types[i].allocationCount;
+        heap.blockCount      += m_types[i].blockCount;
+    }
+
+    stats.categories = m_categories;
+    stats.total      = m_total;
+
+    return stats;
+}
+
+static void writeUsage(std::ostream &stream, const VulkanMemoryUsage &usage)
+{
+    stream << "\"allocatedBytes\": "  << usage.allocatedBytes  << ", "
+           << "\"usedBytes\": "       << usage.usedBytes       << ", "
+           << "\"allocations\": "     << usage.allocationCount << ", "
+           << "\"blocks\": "          << usage.blockCount      << ", "
+           << "\"fragmentation\": "   << usage.GetFragmentation();
+}
+
+void VulkanMemoryAllocator::WriteReport(std::ostream &stream) const
+{
+    VulkanMemoryStats stats = GetStats();
+
+    stream << std::fixed << std::setprecision(4);
+
+    stream << "{\n";
+    stream << "  \"total\": { ";
+    writeUsage(stream, stats.total);
+    stream << " },\n";
+
+    stream << "  \"heaps\": [\n";
+    for (size_t i = 0; i < stats.heaps.size(); ++i)
+    {
+        const VulkanMemoryHeapStats &heap = stats.heaps[i];
+
+        stream << "    { \"index\": " << i << ", "
+               << "\"deviceLocal\": " << ((heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) ? "true" : "false") << ", "
+               << "\"size\": "        << heap.size   << ", "
+               << "\"budget\": "      << heap.budget << ", "
+               << "\"usage\": "       << heap.usage  << ", ";
+        writeUsage(stream, heap.allocator);
+        stream << " }" << (i + 1 < stats.heaps.size() ? ",\n" : "\n");
+    }
+    stream << "  ],\n";
+
+    stream << "  \"types\": [\n";
+    for (size_t i = 0; i < stats.types.size(); ++i)
+    {
+        const VulkanMemoryTypeStats &type = stats.types[i];
+
+        stream << "    { \"index\": " << i << ", "
+               << "\"heap\": "        << type.heapIndex << ", "
+               << "\"flags\": "       << type.flags     << ", ";
+        writeUsage(stream, type.allocator);
+        stream << " }" << (i + 1 < stats.types.size() ? ",\n" : "\n");
+    }
+    stream << "  ],\n";
+
+    stream << "  \"categories\": {\n";
+    for (size_t i = 0; i < stats.categories.size(); ++i)
+    {
+        stream << "    \"" << getMemoryCategoryName(static_cast<VulkanMemoryCategory>(i)) << "\": { "
+               << "\"usedBytes\": "   << stats.categories[i].usedBytes       << ", "
+               << "\"allocations\": " << stats.categories[i].allocationCount
+               << " }" << (i + 1 < stats.categories.size() ? ",\n" : "\n");
+    }
+    stream << "  }\n";
+
+    stream << "}\n";
+}
+
+void VulkanMemoryAllocator::TrackBlock(uint32_t memoryTypeIndex, VkDeviceSize size, bool isFreed)
+{
+    VulkanMemoryUsage *usages[] = {
+        &m_types[memoryTypeIndex],
+        &m_total
+    };
+
+    for (VulkanMemoryUsage *usage : usages)
+    {
+        if (isFreed)
+        {
+            usage->allocatedBytes -= size;
+            usage->blockCount--;
+        }
+        else
+        {
+            usage->allocatedBytes += size;
+            usage->blockCount++;
+        }
+    }
+}
+
+void VulkanMemoryAllocator::TrackAllocation(
+    uint32_t             memoryTypeIndex,
+    VulkanMemoryCategory category,
+    VkDeviceSize         size,
+    bool                 isFreed
+) {
+    VulkanMemoryUsage *usages[] = {
+        &m_types[memoryTypeIndex],
+        &m_categories[static_cast<size_t>(category)],
+        &m_total
+    };
+
+    for (VulkanMemoryUsage *usage : usages)
+    {
+        if (isFreed)
+        {
+            usage->usedBytes -= size;
+            usage->allocationCount--;
+        }
+        else
+        {
+            usage->usedBytes += size;
+            usage->allocationCount++;
+        }
+    }
+}
+
+std::vector<uint32_t> VulkanMemoryAllocator::FindMemoryTypes(
+    uint32_t                     typeFilter,
+    const VulkanMemoryPreference &preference,
+    VkDeviceSize                 size
 ) const {
+    struct Candidate
+    {
+        uint32_t     index        = 0;
+        bool         isOverBudget = false;
+        int          score        = 0;
+        VkDeviceSize heapSize     = 0;
+    };
 
-    VkPhysicalDeviceMemoryProperties memProperties;
-    vkGetPhysicalDeviceMemoryProperties(physicalDevice.GetHandle(), &memProperties);
+    // Protected Memory Needs Protected Resources, Device Coherent Memory is Slow
+    constexpr VkMemoryPropertyFlags avoided =
+        VK_MEMORY_PROPERTY_PROTECTED_BIT          |
+        VK_MEMORY_PROPERTY_DEVICE_COHERENT_BIT_AMD |
+        VK_MEMORY_PROPERTY_DEVICE_UNCACHED_BIT_AMD;
 
-    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++)
+    std::vector<Candidate> candidates;
+    for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++)
     {
-        if ((typeFilter & (1 << i)) && 
-            ((memProperties.memoryTypes[i].propertyFlags & properties) == properties))
-            return i;
+        if (!(typeFilter & (1u << i)))
+            continue;
+
+        VkMemoryPropertyFlags flags     = m_memoryProperties.memoryTypes[i].propertyFlags;
+        uint32_t              heapIndex = m_memoryProperties.memoryTypes[i].heapIndex;
+        VkDeviceSize          heapSize  = m_memoryProperties.memoryHeaps[heapIndex].size;
+
+        if ((flags & preference.required) != preference.required)
+            continue;
+        if (flags & avoided & ~preference.required)
+            continue;
+        if (size > heapSize)
+            continue;
+
+        Candidate candidate{};
+        candidate.index        = i;
+        candidate.score        = std::popcount(flags & preference.preferred) - std::popcount(flags & preference.notPreferred);
+        candidate.heapSize     = heapSize;
+        candidate.isOverBudget = m_heapBudgets[heapIndex] > 0 && m_heapUsage[heapIndex] + size > m_heapBudgets[heapIndex];
+
+        candidates.push_back(candidate);
     }
-    
-    throw std::runtime_error("Failed to Find Suitable Memory Type.");
+
+    // Heaps Past their Budget Last, then Best Score, then the Larger Heap
+    std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) {
+        if (a.isOverBudget != b.isOverBudget) return !a.isOverBudget;
+        if (a.score        != b.score)        return a.score > b.score;
+        return a.heapSize > b.heapSize;
+    });
+
+    std::vector<uint32_t> memoryTypes;
+    for (const auto &candidate : candidates)
+        memoryTypes.push_back(candidate.index);
+
+    return memoryTypes;
 }
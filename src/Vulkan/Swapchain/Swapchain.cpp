@@ -21,11 +21,13 @@ VulkanSwapchain::VulkanSwapchain(
     const VulkanDevice &device,
     VkSwapchainKHR handle,
     VkExtent2D     extent,
-    VkFormat       format
+    VkFormat       format,
+    VkFormat       depthFormat
 ) : m_device(device),
     m_handle(handle),
     m_extent(extent),
-    m_format(format)
+    m_format(format),
+    m_depthFormat(depthFormat)
 {}
 
 VulkanSwapchain::~VulkanSwapchain()
@@ -68,6 +70,9 @@ std::unique_ptr<VulkanSwapchain> VulkanSwapchain::Create(
     createInfo.imageArrayLayers = 1;
     createInfo.imageUsage       = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
 
+    // Transfer Source Lets Presented Frames be Read Back
+    createInfo.imageUsage |= swapChainSupport.capabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+
     std::vector<uint32_t> queueFamilyIndices;
     std::set<uint32_t> uniqueQueueFamilies = {
         device.GetGraphicsQueueFamily(),
@@ -107,19 +112,48 @@ std::unique_ptr<VulkanSwapchain> VulkanSwapchain::Create(
 
     std::cout << "[INFO]\tSwapchain Created Successfully\n";
 
-    return std::unique_ptr<VulkanSwapchain>(
+    auto swapchain = std::unique_ptr<VulkanSwapchain>(
         new VulkanSwapchain(
             device,
             handle,
             extent,
-            surfaceFormat.format
+            surfaceFormat.format,
+            VulkanSwapchain::ChooseDepthFormat(physicalDevice.GetHandle())
+        )
+    );
+    swapchain->m_imageUsage = createInfo.imageUsage;
+
+    return swapchain;
+}
+
+std::unique_ptr<VulkanSwapchain> VulkanSwapchain::CreateHeadless(
+    const VulkanPhysicalDevice &physicalDevice,
+    const VulkanDevice         &device,
+    VkExtent2D extent,
+    uint32_t   imageCount
+) {
+    auto swapchain = std::unique_ptr<VulkanSwapchain>(
+        new VulkanSwapchain(
+            device,
+            VK_NULL_HANDLE,
+            extent,
+            VK_FORMAT_R8G8B8A8_SRGB,
+            VulkanSwapchain::ChooseDepthFormat(physicalDevice.GetHandle())
         )
     );
+    swapchain->m_imageCount = imageCount;
+    swapchain->m_imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+
+    std::cout << "[INFO]\tHeadless Swapchain Created Successfully\n";
+
+    return swapchain;
 }
 
 void VulkanSwapchain::Cleanup()
 {
     m_framebuffers.clear();
+    m_depthImageView.reset();
+    m_depthImage.reset();
     m_imageViews.clear();
     m_images.clear();
 
@@ -135,13 +169,34 @@ void VulkanSwapchain::CreateImages(
     const VulkanPhysicalDevice &physicalDevice,
     VulkanMemoryAllocator      &allocator
 ) {
+    m_images.clear();
+
+    // Headless Images are Owned, and can be Copied Out after the Frame
+    if (IsHeadless())
+    {
+        for (uint32_t i = 0; i < m_imageCount; ++i)
+        {
+            m_images.emplace_back(VulkanImage::Create(
+                physicalDevice,
+                m_device,
+                allocator,
+                {m_extent.width, m_extent.height, 1},
+                m_format,
+                1, 1,
+                VK_IMAGE_TILING_OPTIMAL,
+                m_imageUsage,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+            ));
+        }
+
+        return;
+    }
+
     vkGetSwapchainImagesKHR(m_device.GetHandle(), m_handle, &m_imageCount, nullptr);
 
     std::vector<VkImage> vkImages(m_imageCount, VK_NULL_HANDLE);
     vkGetSwapchainImagesKHR(m_device.GetHandle(), m_handle, &m_imageCount, vkImages.data());
 
-    m_images.clear();
-
     for (uint32_t i = 0; i < m_imageCount; ++i)
     {
         m_images.emplace_back(VulkanImage::Create(
@@ -152,7 +207,7 @@ void VulkanSwapchain::CreateImages(
             m_format,
             1, 1,
             VK_IMAGE_TILING_OPTIMAL,
-            VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+            m_imageUsage,
             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
             vkImages[i]
         ));
@@ -176,6 +231,35 @@ void VulkanSwapchain::CreateImageViews()
     std::cout << "[INFO]\tSwapchain Image Views Created Successfully.\n";
 }
 
+void VulkanSwapchain::CreateDepthResources(
+    const VulkanPhysicalDevice &physicalDevice,
+    VulkanMemoryAllocator      &allocator
+) {
+    m_depthImageView.reset();
+    m_depthImage.reset();
+
+    m_depthImage = VulkanImage::Create(
+        physicalDevice,
+        m_device,
+        allocator,
+        {m_extent.width, m_extent.height, 1},
+        m_depthFormat,
+        1, 1,
+        VK_IMAGE_TILING_OPTIMAL,
+        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+    );
+
+    m_depthImageView = VulkanImageView::CreateFromImage(
+        m_device,
+        *m_depthImage,
+        VK_IMAGE_VIEW_TYPE_2D,
+        VK_IMAGE_ASPECT_DEPTH_BIT
+    );
+
+    std::cout << "[INFO]\tSwapchain Depth Resources Created Successfully.\n";
+}
+
 void VulkanSwapchain::CreateFramebuffers(const VulkanRenderPass &renderPass)
 {
     m_framebuffers.clear();
@@ -183,7 +267,8 @@ void VulkanSwapchain::CreateFramebuffers(const VulkanRenderPass &renderPass)
     for (size_t i = 0; i < m_imageCount; ++i)
     {
         std::vector<VkImageView> attachments = {
-            m_imageViews[i]->GetHandle()
+            m_imageViews[i]->GetHandle(),
+            m_depthImageView->GetHandle()
         };
 
         m_framebuffers.emplace_back(VulkanFramebuffer::Create(
@@ -197,11 +282,23 @@ void VulkanSwapchain::CreateFramebuffers(const VulkanRenderPass &renderPass)
     std::cout << "[INFO]\tSwapchain Framebuffers Created Successfully.\n";
 }
 
+uint32_t VulkanSwapchain::AcquireHeadlessImage(uint32_t currentFrame) const
+{
+    // The Frame's Fence was Waited On, so its Image is No Longer in Use
+    return currentFrame % m_imageCount;
+}
+
+VkImageLayout VulkanSwapchain::GetFinalLayout() const
+{
+    return IsHeadless() ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+}
+
 VulkanSwapchain::VulkanSwapchain(VulkanSwapchain &&other) noexcept : 
     m_device(other.m_device),
     m_handle(other.m_handle),
     m_extent(other.m_extent),
-    m_format(other.m_format)
+    m_format(other.m_format),
+    m_depthFormat(other.m_depthFormat)
 {
     other.m_handle    = VK_NULL_HANDLE;
     other.m_extent    = {0, 0};
@@ -217,6 +314,7 @@ VulkanSwapchain& VulkanSwapchain::operator=(VulkanSwapchain &&other) noexcept
         m_handle = other.m_handle;
         m_extent = other.m_extent;
         m_format = other.m_format;
+        m_depthFormat = other.m_depthFormat;
 
         other.m_handle = VK_NULL_HANDLE;
         other.m_extent = {0, 0};
@@ -277,6 +375,26 @@ VkPresentModeKHR VulkanSwapchain::ChooseSwapPresentMode(const std::vector<VkPres
     return VK_PRESENT_MODE_FIFO_KHR;
 }
 
+VkFormat VulkanSwapchain::ChooseDepthFormat(VkPhysicalDevice device)
+{
+    // Float Depth Keeps Precision Uniform under Reverse-Z
+    const std::vector<VkFormat> candidates = {
+        VK_FORMAT_D32_SFLOAT,
+        VK_FORMAT_D32_SFLOAT_S8_UINT
+    };
+
+    for (VkFormat format : candidates)
+    {
+        VkFormatProperties properties;
+        vkGetPhysicalDeviceFormatProperties(device, format, &properties);
+
+        if (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT)
+            return format;
+    }
+
+    throw std::runtime_error("Failed to find a Supported Float Depth Format.");
+}
+
 VkExtent2D VulkanSwapchain::ChooseSwapExtent(const VkSurfaceCapabilitiesKHR &capabilities, int windowWidth, int windowHeight)
 {
     if (capabilities.currentExtent.width != UINT32_MAX)
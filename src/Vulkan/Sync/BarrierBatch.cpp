@@ -0,0 +1,324 @@
+#include "Vulkan/Sync/BarrierBatch.hpp"
+
+#include "Vulkan/Core/Device.hpp"
+#include "Vulkan/Resources/Buffer.hpp"
+#include "Vulkan/Resources/Image.hpp"
+
+// Only Legacy-Representable Bits are Used, so the Fallback can Narrow them
+constexpr VkAccessFlags2 WRITE_ACCESS_MASK = VK_ACCESS_2_SHADER_WRITE_BIT                 |
+                                             VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT         |
+                                             VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+                                             VK_ACCESS_2_TRANSFER_WRITE_BIT                 |
+                                             VK_ACCESS_2_HOST_WRITE_BIT                     |
+                                             VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+VulkanBarrierBatch::VulkanBarrierBatch(
+    const VulkanDevice        &device,
+    std::pmr::memory_resource *resource
+) : m_device(device),
+    m_imageBarriers(resource),
+    m_bufferBarriers(resource)
+{}
+
+VulkanLayoutSync VulkanBarrierBatch::GetLayoutSync(
+    VkImageLayout     layout,
+    VkImageUsageFlags usage,
+    bool isSource
+) {
+    // Sampled Images are Read in Fragment Shaders, Storage Images in Compute
+    VkPipelineStageFlags2 shaderStages = 0;
+    if (usage & (VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT))
+        shaderStages |= VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+    if (usage & VK_IMAGE_USAGE_STORAGE_BIT)
+        shaderStages |= VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+    if (shaderStages == 0)
+        shaderStages  = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+
+    VulkanLayoutSync sync{};
+
+    switch (layout)
+    {
+        case VK_IMAGE_LAYOUT_UNDEFINED:
+            break;
+
+        case VK_IMAGE_LAYOUT_PREINITIALIZED:
+            sync = { VK_PIPELINE_STAGE_2_HOST_BIT, VK_ACCESS_2_HOST_WRITE_BIT };
+            break;
+
+        case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+            sync = {
+                VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT
+            };
+            break;
+
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+        case VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL:
+        case VK_IMAGE_LAYOUT_STENCIL_ATTACHMENT_OPTIMAL:
+            sync = {
+                VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+            };
+            break;
+
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
+        case VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_OPTIMAL:
+        case VK_IMAGE_LAYOUT_STENCIL_READ_ONLY_OPTIMAL:
+            sync = {
+                VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+                VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT
+            };
+            if (usage & VK_IMAGE_USAGE_SAMPLED_BIT)
+            {
+                sync.stages |= shaderStages;
+                sync.access |= VK_ACCESS_2_SHADER_READ_BIT;
+            }
+            break;
+
+        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+            sync = { shaderStages, VK_ACCESS_2_SHADER_READ_BIT };
+            if (usage & VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT)
+                sync.access |= VK_ACCESS_2_INPUT_ATTACHMENT_READ_BIT;
+            break;
+
+        case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+            sync = { VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_READ_BIT };
+            break;
+
+        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+            sync = { VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT };
+            break;
+
+        case VK_IMAGE_LAYOUT_GENERAL:
+            if (usage & VK_IMAGE_USAGE_STORAGE_BIT)
+                sync = { shaderStages, VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_SHADER_WRITE_BIT };
+            else
+                sync = { VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT };
+            break;
+
+        case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
+            // Presentation is Ordered by Semaphores, Coming Back Chains with the Acquire Wait Stage
+            if (isSource)
+                sync = { VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_NONE };
+            break;
+
+        default:
+            sync = { VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT };
+            break;
+    }
+
+    if (isSource)
+        sync.access &= WRITE_ACCESS_MASK;
+
+    return sync;
+}
+
+VulkanLayoutSync VulkanBarrierBatch::GetBufferSync(
+    VkBufferUsageFlags usage,
+    bool isSource
+) {
+    constexpr VkPipelineStageFlags2 shaderStages = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+
+    VulkanLayoutSync sync{};
+
+    if (usage & (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT))
+    {
+        sync.stages |= VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+        if (usage & VK_BUFFER_USAGE_TRANSFER_SRC_BIT)
+            sync.access |= VK_ACCESS_2_TRANSFER_READ_BIT;
+        if (usage & VK_BUFFER_USAGE_TRANSFER_DST_BIT)
+            sync.access |= VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    }
+    if (usage & VK_BUFFER_USAGE_VERTEX_BUFFER_BIT)
+    {
+        sync.stages |= VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT;
+        sync.access |= VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT;
+    }
+    if (usage & VK_BUFFER_USAGE_INDEX_BUFFER_BIT)
+    {
+        sync.stages |= VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT;
+        sync.access |= VK_ACCESS_2_INDEX_READ_BIT;
+    }
+    if (usage & VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT)
+    {
+        sync.stages |= shaderStages;
+        sync.access |= VK_ACCESS_2_UNIFORM_READ_BIT;
+    }
+    if (usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)
+    {
+        sync.stages |= shaderStages | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+        sync.access |= VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_SHADER_WRITE_BIT;
+    }
+    if (usage & VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT)
+    {
+        sync.stages |= VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT;
+        sync.access |= VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT;
+    }
+
+    if (isSource)
+        sync.access &= WRITE_ACCESS_MASK;
+
+    return sync;
+}
+
+VulkanBarrierBatch& VulkanBarrierBatch::AddImage(
+    const VulkanImage  &image,
+    VkImageLayout      oldLayout,
+    VkImageLayout      newLayout,
+    VkImageAspectFlags aspectMask,
+    uint32_t mipLevels,
+    uint32_t arrayLayers
+) {
+    VulkanLayoutSync src = GetLayoutSync(oldLayout, image.GetUsage(), true);
+    VulkanLayoutSync dst = GetLayoutSync(newLayout, image.GetUsage(), false);
+
+    // Swapchain Images Become Writable at the Acquire Semaphore's Wait Stage
+    if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && image.IsSwapchainImage())
+        src.stages = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+    VkImageMemoryBarrier2 barrier{};
+    barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    barrier.srcStageMask        = src.stages;
+    barrier.srcAccessMask       = src.access;
+    barrier.dstStageMask        = dst.stages;
+    barrier.dstAccessMask       = dst.access;
+    barrier.oldLayout           = oldLayout;
+    barrier.newLayout           = newLayout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image               = image.GetHandle();
+    barrier.subresourceRange    = { aspectMask, 0, mipLevels, 0, arrayLayers };
+
+    return AddImage(barrier);
+}
+
+VulkanBarrierBatch& VulkanBarrierBatch::AddImage(const VkImageMemoryBarrier2 &barrier)
+{
+    m_imageBarriers.push_back(barrier);
+    return *this;
+}
+
+VulkanBarrierBatch& VulkanBarrierBatch::AddBuffer(
+    const VulkanBuffer    &buffer,
+    VkPipelineStageFlags2 srcStages,
+    VkAccessFlags2        srcAccess,
+    VkPipelineStageFlags2 dstStages,
+    VkAccessFlags2        dstAccess
+) {
+    return AddBuffer(buffer.GetHandle(), 0, VK_WHOLE_SIZE, srcStages, srcAccess, dstStages, dstAccess);
+}
+
+VulkanBarrierBatch& VulkanBarrierBatch::AddBuffer(
+    VkBuffer              buffer,
+    VkDeviceSize          offset,
+    VkDeviceSize          size,
+    VkPipelineStageFlags2 srcStages,
+    VkAccessFlags2        srcAccess,
+    VkPipelineStageFlags2 dstStages,
+    VkAccessFlags2        dstAccess
+) {
+    VkBufferMemoryBarrier2 barrier{};
+    barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+    barrier.srcStageMask        = srcStages;
+    barrier.srcAccessMask       = srcAccess & WRITE_ACCESS_MASK;
+    barrier.dstStageMask        = dstStages;
+    barrier.dstAccessMask       = dstAccess;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer              = buffer;
+    barrier.offset              = offset;
+    barrier.size                = size;
+
+    return AddBuffer(barrier);
+}
+
+VulkanBarrierBatch& VulkanBarrierBatch::AddBuffer(const VkBufferMemoryBarrier2 &barrier)
+{
+    m_bufferBarriers.push_back(barrier);
+    return *this;
+}
+
+void VulkanBarrierBatch::Record(VkCommandBuffer commandBuffer)
+{
+    if (IsEmpty())
+        return;
+
+    if (!m_device.IsSynchronization2Enabled())
+    {
+        RecordLegacy(commandBuffer);
+    }
+    else
+    {
+        VkDependencyInfo dependencyInfo{};
+        dependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(m_bufferBarriers.size());
+        dependencyInfo.pBufferMemoryBarriers    = m_bufferBarriers.data();
+        dependencyInfo.imageMemoryBarrierCount  = static_cast<uint32_t>(m_imageBarriers.size());
+        dependencyInfo.pImageMemoryBarriers     = m_imageBarriers.data();
+
+        vkCmdPipelineBarrier2(commandBuffer, &dependencyInfo);
+    }
+
+    m_imageBarriers.clear();
+    m_bufferBarriers.clear();
+}
+
+void VulkanBarrierBatch::RecordLegacy(VkCommandBuffer commandBuffer)
+{
+    // One Stage Mask per Call, so Barriers Share the Union of their Stages
+    VkPipelineStageFlags srcStages = 0;
+    VkPipelineStageFlags dstStages = 0;
+
+    std::pmr::vector<VkImageMemoryBarrier> imageBarriers(m_imageBarriers.get_allocator());
+    imageBarriers.reserve(m_imageBarriers.size());
+
+    for (const auto &barrier : m_imageBarriers)
+    {
+        srcStages |= static_cast<VkPipelineStageFlags>(barrier.srcStageMask);
+        dstStages |= static_cast<VkPipelineStageFlags>(barrier.dstStageMask);
+
+        VkImageMemoryBarrier imageBarrier{};
+        imageBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        imageBarrier.srcAccessMask       = static_cast<VkAccessFlags>(barrier.srcAccessMask);
+        imageBarrier.dstAccessMask       = static_cast<VkAccessFlags>(barrier.dstAccessMask);
+        imageBarrier.oldLayout           = barrier.oldLayout;
+        imageBarrier.newLayout           = barrier.newLayout;
+        imageBarrier.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+        imageBarrier.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+        imageBarrier.image               = barrier.image;
+        imageBarrier.subresourceRange    = barrier.subresourceRange;
+
+        imageBarriers.push_back(imageBarrier);
+    }
+
+    std::pmr::vector<VkBufferMemoryBarrier> bufferBarriers(m_bufferBarriers.get_allocator());
+    bufferBarriers.reserve(m_bufferBarriers.size());
+
+    for (const auto &barrier : m_bufferBarriers)
+    {
+        srcStages |= static_cast<VkPipelineStageFlags>(barrier.srcStageMask);
+        dstStages |= static_cast<VkPipelineStageFlags>(barrier.dstStageMask);
+
+        VkBufferMemoryBarrier bufferBarrier{};
+        bufferBarrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        bufferBarrier.srcAccessMask       = static_cast<VkAccessFlags>(barrier.srcAccessMask);
+        bufferBarrier.dstAccessMask       = static_cast<VkAccessFlags>(barrier.dstAccessMask);
+        bufferBarrier.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+        bufferBarrier.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+        bufferBarrier.buffer              = barrier.buffer;
+        bufferBarrier.offset              = barrier.offset;
+        bufferBarrier.size                = barrier.size;
+
+        bufferBarriers.push_back(bufferBarrier);
+    }
+
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        srcStages != 0 ? srcStages : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT),
+        dstStages != 0 ? dstStages : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT),
+        0,
+        0, nullptr,
+        static_cast<uint32_t>(bufferBarriers.size()), bufferBarriers.data(),
+        static_cast<uint32_t>(imageBarriers.size()),  imageBarriers.data()
+    );
+}
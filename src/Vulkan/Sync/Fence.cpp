@@ -65,6 +65,16 @@ void VulkanFence::Wait()
     vkResetFences(m_device.GetHandle(), 1, &m_handle);
 }
 
+bool VulkanFence::IsSignaled() const
+{
+    return vkGetFenceStatus(m_device.GetHandle(), m_handle) == VK_SUCCESS;
+}
+
+void VulkanFence::Reset()
+{
+    vkResetFences(m_device.GetHandle(), 1, &m_handle);
+}
+
 VulkanFence::VulkanFence(VulkanFence &&other) noexcept : 
     m_device(other.m_device),
     m_handle(other.m_handle),
@@ -1,17 +1,28 @@
 #include "Vulkan/Sync/Sync.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <iostream>
+#include <stdexcept>
 
+#include "Vulkan/Core/Device.hpp"
+#include "Vulkan/Commands/CommandPool.hpp"
 #include "Vulkan/Sync/Semaphore.hpp"
 #include "Vulkan/Sync/Fence.hpp"
 
+#include "Profiling/CpuProfiler.hpp"
+
 VulkanSync::VulkanSync(
+    const VulkanDevice &device,
     std::vector<std::unique_ptr<VulkanFence>>     inFlightFences,
     std::vector<std::unique_ptr<VulkanSemaphore>> imageSemaphores,
     std::vector<std::unique_ptr<VulkanSemaphore>> renderSemaphores
-) : m_inFlightFences(std::move(inFlightFences)),
+) : m_device(device),
+    m_inFlightFences(std::move(inFlightFences)),
     m_imageSemaphores(std::move(imageSemaphores)),
-    m_renderSemaphores(std::move(renderSemaphores))
+    m_renderSemaphores(std::move(renderSemaphores)),
+    m_isFrameIdle(m_inFlightFences.size(), true),
+    m_frameWaits(m_inFlightFences.size())
 {}
 
 VulkanSync::~VulkanSync()
@@ -52,6 +63,7 @@ std::unique_ptr<VulkanSync> VulkanSync::Create(
 
     return std::unique_ptr<VulkanSync>(
         new VulkanSync(
+            device,
             std::move(inFlightFences),
             std::move(imageSemaphores),
             std::move(renderSemaphores)
@@ -61,20 +73,225 @@ std::unique_ptr<VulkanSync> VulkanSync::Create(
 
 void VulkanSync::Cleanup()
 {
+    m_frameWaits.clear();
+
+    // Command Buffers are Freed with their Pools
+    m_pendingUploads.clear();
+    m_freeCommandBuffers.clear();
+
+    m_freeFences.clear();
+    m_freeSemaphores.clear();
+    m_retiringSemaphores.clear();
+    m_fences.clear();
+    m_semaphores.clear();
+
     m_imageSemaphores.clear();
     m_renderSemaphores.clear();
     m_inFlightFences.clear();
+    m_isFrameIdle.clear();
 }
 
 void VulkanSync::WaitForFence(uint32_t currentFrame)
 {
+    PROFILE_ZONE("WaitForFence");
+
     m_inFlightFences[currentFrame]->Wait();
+    m_isFrameIdle[currentFrame] = true;
+
+    m_frameNumber++;
+
+    // The Fence Just Waited On Ends the Frame FRAMES_IN_FLIGHT Back, Compacted in Place
+    uint64_t frameCount = m_inFlightFences.size();
+    size_t   pending    = 0;
+    for (auto &retiring : m_retiringSemaphores)
+    {
+        if (retiring.frameNumber + frameCount <= m_frameNumber)
+            m_freeSemaphores.push_back(retiring.semaphore);
+        else
+            m_retiringSemaphores[pending++] = retiring;
+    }
+    m_retiringSemaphores.resize(pending);
+
+    CollectUploads(false);
+}
+
+VulkanFence* VulkanSync::AcquireFence()
+{
+    if (m_freeFences.empty())
+    {
+        m_fences.push_back(VulkanFence::Create(m_device, 0));
+        return m_fences.back().get();
+    }
+
+    VulkanFence *fence = m_freeFences.back();
+    m_freeFences.pop_back();
+
+    return fence;
+}
+
+void VulkanSync::ReleaseFence(VulkanFence *fence)
+{
+    if (fence != nullptr)
+        m_freeFences.push_back(fence);
+}
+
+VulkanSemaphore* VulkanSync::AcquireSemaphore()
+{
+    if (m_freeSemaphores.empty())
+    {
+        m_semaphores.push_back(VulkanSemaphore::Create(m_device, VK_SEMAPHORE_TYPE_BINARY));
+        return m_semaphores.back().get();
+    }
+
+    VulkanSemaphore *semaphore = m_freeSemaphores.back();
+    m_freeSemaphores.pop_back();
+
+    return semaphore;
+}
+
+void VulkanSync::ReleaseSemaphore(VulkanSemaphore *semaphore)
+{
+    if (semaphore == nullptr)
+        return;
+
+    // Released Before the First Frame, the Wait is Part of that Frame at the Latest
+    m_retiringSemaphores.push_back({ std::max<uint64_t>(m_frameNumber, 1), semaphore });
+}
+
+VkCommandBuffer VulkanSync::AcquireCommandBuffer(const VulkanCommandPool &commandPool)
+{
+    for (size_t i = m_freeCommandBuffers.size(); i-- > 0;)
+    {
+        if (m_freeCommandBuffers[i].commandPool != commandPool.GetHandle())
+            continue;
+
+        VkCommandBuffer commandBuffer = m_freeCommandBuffers[i].commandBuffer;
+
+        m_freeCommandBuffers[i] = m_freeCommandBuffers.back();
+        m_freeCommandBuffers.pop_back();
+
+        return commandBuffer;
+    }
+
+    VkCommandBufferAllocateInfo allocInfo{};
+    allocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandPool        = commandPool.GetHandle();
+    allocInfo.commandBufferCount = 1;
+
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    VkResult result = vkAllocateCommandBuffers(m_device.GetHandle(), &allocInfo, &commandBuffer);
+    if (result != VK_SUCCESS)
+    {
+        std::cerr << "[ERROR]\t'vkAllocateCommandBuffers' Failed with Error Code " << result << "\n";
+
+        throw std::runtime_error("Failed to Allocate Upload Command Buffer.");
+    }
+
+    return commandBuffer;
+}
+
+uint64_t VulkanSync::TrackUpload(
+    const VulkanCommandPool &commandPool,
+    VkCommandBuffer         commandBuffer,
+    VulkanFence             *fence
+) {
+    uint64_t upload = m_nextUpload++;
+    m_pendingUploads.push_back({ upload, commandPool.GetHandle(), commandBuffer, fence });
+
+    return upload;
+}
+
+void VulkanSync::WaitForUpload(uint64_t upload)
+{
+    auto it = std::find_if(
+        m_pendingUploads.begin(),
+        m_pendingUploads.end(),
+        [upload](const PendingUpload &pending) { return pending.upload == upload; }
+    );
+    if (it == m_pendingUploads.end())
+        return;
+
+    PROFILE_ZONE("WaitForUpload");
+
+    it->fence->Wait();
+    ReclaimUpload(*it);
+
+    m_pendingUploads.erase(it);
+}
+
+void VulkanSync::CollectUploads(bool waitAll)
+{
+    // Compacted in Place, Runs Every Frame
+    size_t pending = 0;
+    for (auto &upload : m_pendingUploads)
+    {
+        if (waitAll)
+        {
+            upload.fence->Wait();
+        }
+        else if (upload.fence->IsSignaled())
+        {
+            upload.fence->Reset();
+        }
+        else
+        {
+            m_pendingUploads[pending++] = upload;
+            continue;
+        }
+
+        ReclaimUpload(upload);
+    }
+    m_pendingUploads.resize(pending);
+}
+
+void VulkanSync::ReclaimUpload(const PendingUpload &upload)
+{
+    m_freeCommandBuffers.push_back({ upload.commandPool, upload.commandBuffer });
+    ReleaseFence(upload.fence);
+}
+
+void VulkanSync::AddFrameWait(uint32_t currentFrame, VkSemaphore semaphore, VkPipelineStageFlags stage)
+{
+    m_frameWaits[currentFrame].semaphores.push_back(semaphore);
+    m_frameWaits[currentFrame].stages.push_back(stage);
+}
+
+void VulkanSync::AddFrameWait(uint32_t currentFrame, VulkanSemaphore *semaphore, VkPipelineStageFlags stage)
+{
+    AddFrameWait(currentFrame, semaphore->GetHandle(), stage);
+    m_frameWaits[currentFrame].pooled.push_back(semaphore);
+}
+
+void VulkanSync::MarkFrameSubmitted(uint32_t currentFrame)
+{
+    m_isFrameIdle[currentFrame] = false;
+
+    FrameWaits &waits = m_frameWaits[currentFrame];
+    for (VulkanSemaphore *semaphore : waits.pooled)
+        ReleaseSemaphore(semaphore);
+
+    waits.semaphores.clear();
+    waits.stages.clear();
+    waits.pooled.clear();
 }
 
 VulkanSync::VulkanSync(VulkanSync &&other) noexcept : 
+    m_device(other.m_device),
     m_inFlightFences(std::move(other.m_inFlightFences)),
     m_imageSemaphores(std::move(other.m_imageSemaphores)),
-    m_renderSemaphores(std::move(other.m_renderSemaphores))
+    m_renderSemaphores(std::move(other.m_renderSemaphores)),
+    m_isFrameIdle(std::move(other.m_isFrameIdle)),
+    m_fences(std::move(other.m_fences)),
+    m_semaphores(std::move(other.m_semaphores)),
+    m_freeFences(std::move(other.m_freeFences)),
+    m_freeSemaphores(std::move(other.m_freeSemaphores)),
+    m_retiringSemaphores(std::move(other.m_retiringSemaphores)),
+    m_pendingUploads(std::move(other.m_pendingUploads)),
+    m_freeCommandBuffers(std::move(other.m_freeCommandBuffers)),
+    m_nextUpload(other.m_nextUpload),
+    m_frameWaits(std::move(other.m_frameWaits)),
+    m_frameNumber(other.m_frameNumber)
 {
     m_inFlightFences    = std::move(other.m_inFlightFences);
     m_imageSemaphores   = std::move(other.m_imageSemaphores);
@@ -90,6 +307,18 @@ VulkanSync& VulkanSync::operator=(VulkanSync &&other) noexcept
         m_inFlightFences   = std::move(other.m_inFlightFences);
         m_imageSemaphores  = std::move(other.m_imageSemaphores);
         m_renderSemaphores = std::move(other.m_renderSemaphores);
+        m_isFrameIdle      = std::move(other.m_isFrameIdle);
+
+        m_fences              = std::move(other.m_fences);
+        m_semaphores          = std::move(other.m_semaphores);
+        m_freeFences          = std::move(other.m_freeFences);
+        m_freeSemaphores      = std::move(other.m_freeSemaphores);
+        m_retiringSemaphores  = std::move(other.m_retiringSemaphores);
+        m_pendingUploads      = std::move(other.m_pendingUploads);
+        m_freeCommandBuffers  = std::move(other.m_freeCommandBuffers);
+        m_nextUpload          = other.m_nextUpload;
+        m_frameWaits          = std::move(other.m_frameWaits);
+        m_frameNumber         = other.m_frameNumber;
     }
 
     return *this;
@@ -1,33 +1,57 @@
 #include "App.hpp"
 
 #include <chrono>
+#include <fstream>
+#include <iostream>
 #include <thread>
 
 #include "Window/Window.hpp"
 #include "Scene/Scene.hpp"
 #include "Vulkan/Renderer/Renderer.hpp"
 #include "Vulkan/Core/Context.hpp"
+#include "Vulkan/Swapchain/Swapchain.hpp"
+#include "Vulkan/Resources/MemoryAllocator.hpp"
+#include "Vulkan/Profiling/GpuProfiler.hpp"
+#include "Vulkan/Profiling/PipelineStatistics.hpp"
 
 #include "Scene/Mesh.hpp"
 
+#include "Profiling/CpuProfiler.hpp"
+
 App::App(
     std::unique_ptr<Window>         window,
     std::unique_ptr<VulkanRenderer> renderer,
-    std::shared_ptr<VulkanScene>    scene
+    std::shared_ptr<VulkanScene>    scene,
+    std::string                     tracePath,
+    std::string                     memoryReportPath
 ) : m_window(std::move(window)),
     m_renderer(std::move(renderer)),
-    m_scene(std::move(scene))
+    m_scene(std::move(scene)),
+    m_tracePath(std::move(tracePath)),
+    m_memoryReportPath(std::move(memoryReportPath))
 {}
 
 App::~App() = default;
 
-App App::Create()
-{
+App App::Create(
+    bool               headless,
+    bool               pipelineStatistics,
+    const std::string &tracePath,
+    const std::string &memoryReportPath
+) {
+#ifndef ENGINE_PROFILING
+    if (!tracePath.empty())
+        std::cerr << "[WARNING]\tBuilt without ENGINE_PROFILING, the Trace will Only Hold GPU Scopes.\n";
+#endif
+
     // Window
-    auto window = Window::Create();
+    std::unique_ptr<Window> window;
+    if (!headless)
+        window = Window::Create();
     
     // Renderer
-    auto renderer = VulkanRenderer::Create(*window);
+    auto renderer = VulkanRenderer::Create(window.get());
+    renderer->SetPipelineStatisticsEnabled(pipelineStatistics);
 
     // Scene
     std::shared_ptr<VulkanScene> scene = std::move(VulkanScene::Create(
@@ -43,16 +67,30 @@ App App::Create()
     return App(
         std::move(window),
         std::move(renderer),
-        std::move(scene)
+        std::move(scene),
+        tracePath,
+        memoryReportPath
     );
 }
 
+bool App::ShouldClose(uint64_t frameNumber) const
+{
+    if (!m_window)
+        return frameNumber >= HEADLESS_FRAME_COUNT;
+
+    return glfwWindowShouldClose(m_window->GetHandle());
+}
+
 void App::Run()
 {
-    double currentFrameTime = glfwGetTime();
-    double lastFrameTime    = currentFrameTime;
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point currentFrameTime = Clock::now();
+    Clock::time_point lastFrameTime    = currentFrameTime;
     double deltaTime;
 
+    uint64_t frameNumber = 0;
+
     std::vector<Vertex> vertices = {
         Vertex(glm::vec3( 0.0f, -0.5f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f)),
         Vertex(glm::vec3( 0.5f,  0.5f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f)),
@@ -74,7 +112,8 @@ void App::Run()
     for (uint32_t currentFrame = 0; currentFrame < FRAMES_IN_FLIGHT; ++currentFrame)
     {
         mesh->UpdateBuffers(
-            m_renderer->GetCommandPool(),
+            m_renderer->GetTransferCommandPool(),
+            m_renderer->GetSync(),
             vertices,
             indices,
             currentFrame
@@ -83,36 +122,121 @@ void App::Run()
 
     m_scene->AddMesh(std::move(mesh));
 
-    while (!glfwWindowShouldClose(m_window->GetHandle()))
+    if (!m_tracePath.empty())
+        CpuProfiler::BeginCapture();
+
+    while (!ShouldClose(frameNumber))
     {
-        currentFrameTime = glfwGetTime();
-        deltaTime        = currentFrameTime - lastFrameTime;
+        currentFrameTime = Clock::now();
+        deltaTime        = std::chrono::duration<double>(currentFrameTime - lastFrameTime).count();
         
         // Exit if ESC is Pressed
-        if (glfwGetKey(m_window->GetHandle(), GLFW_KEY_ESCAPE) == GLFW_PRESS)
+        if (m_window && glfwGetKey(m_window->GetHandle(), GLFW_KEY_ESCAPE) == GLFW_PRESS)
             glfwSetWindowShouldClose(m_window->GetHandle(), true);
 
-        // Limit FPS
-        if (deltaTime < FRAME_TIME)
+        // Limit FPS, Headless Runs as Fast as the Device Allows
+        if (m_window && deltaTime < FRAME_TIME)
         {
             double sleepTime = FRAME_TIME - deltaTime;
             if (sleepTime > 0.0)
                 std::this_thread::sleep_for(std::chrono::duration<double>(sleepTime));
 
-            currentFrameTime = glfwGetTime();
-            deltaTime = currentFrameTime - lastFrameTime;
+            currentFrameTime = Clock::now();
+            deltaTime = std::chrono::duration<double>(currentFrameTime - lastFrameTime).count();
         }
         lastFrameTime = currentFrameTime;
-        
+
+        // The Frame's Uniforms are Written Only once the GPU is Done with Them
+        m_renderer->BeginFrame();
+
         m_scene->Update(
-            *m_window,
+            m_window.get(),
+            m_renderer->GetSwapchain().GetExtent(),
             deltaTime,
             m_renderer->GetCurrentFrame()
         );
         m_renderer->Draw();
 
-        glfwPollEvents();
+        if (m_window)
+            glfwPollEvents();
+
+        frameNumber++;
+
+        // Drained Every Frame so the Per-Thread Rings Never Fill
+        if (CpuProfiler::IsCapturing())
+        {
+            CpuProfiler::Flush();
+
+            if (frameNumber == TRACE_CAPTURE_FRAMES)
+                WriteTrace();
+        }
     }
 
     m_renderer->Finish();
+
+    if (CpuProfiler::IsCapturing())
+        WriteTrace();
+
+    LogFrameReport();
+
+    if (!m_memoryReportPath.empty())
+        WriteMemoryReport();
+}
+
+void App::WriteTrace() const
+{
+    std::vector<CpuProfileEvent> events = CpuProfiler::EndCapture();
+
+    std::ofstream file(m_tracePath);
+    if (!file)
+    {
+        std::cerr << "[ERROR]\tFailed to Open '" << m_tracePath << "'.\n";
+        return;
+    }
+
+    CpuProfiler::WriteChromeTrace(file, events);
+
+    std::cout << "[INFO]\tTrace of " << events.size() << " Zones Written to '" << m_tracePath << "'.\n";
+}
+
+void App::WriteMemoryReport() const
+{
+    std::ofstream file(m_memoryReportPath);
+    if (!file)
+    {
+        std::cerr << "[ERROR]\tFailed to Open '" << m_memoryReportPath << "'.\n";
+        return;
+    }
+
+    m_renderer->GetAllocator().WriteReport(file);
+
+    std::cout << "[INFO]\tMemory Report Written to '" << m_memoryReportPath << "'.\n";
+}
+
+void App::LogFrameReport() const
+{
+    if (const VulkanGpuProfiler *profiler = m_renderer->GetGpuProfiler())
+    {
+        for (const auto &scope : profiler->GetScopes())
+        {
+            std::cout << "[INFO]\tGPU '" << scope.name << "': "
+                      << scope.avg << " ms Avg, "
+                      << scope.min << " ms Min, "
+                      << scope.max << " ms Max\n";
+        }
+    }
+
+    if (const VulkanPipelineStatistics *statistics = m_renderer->GetPipelineStatistics())
+    {
+        for (const auto &result : statistics->GetResults())
+        {
+            std::cout << "[INFO]\tPipeline Statistics '" << result.name << "': "
+                      << result.inputAssemblyVertices     << " IA Vertices, "
+                      << result.inputAssemblyPrimitives   << " IA Primitives, "
+                      << result.vertexShaderInvocations   << " VS Invocations, "
+                      << result.clippingInvocations       << " Clipping Invocations, "
+                      << result.clippingPrimitives        << " Clipping Primitives, "
+                      << result.fragmentShaderInvocations << " FS Invocations\n";
+        }
+    }
 }
@@ -1,13 +1,35 @@
 #include <cstdlib>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 
 #include "App.hpp"
 
-int main()
+int main(int argc, char **argv)
 {
+    // --headless Renders Offscreen without a Window or Surface
+    // --pipeline-stats Counts Shader Invocations per Pass, Reported on Exit
+    // --trace file.json Writes the First Frames' CPU Zones and GPU Scopes as a Chrome Trace
+    // --memory-report file.json Writes Heap, Memory Type and Category Usage on Exit
+    bool        headless           = false;
+    bool        pipelineStatistics = false;
+    std::string tracePath;
+    std::string memoryReportPath;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string argument = argv[i];
+        if (argument == "--headless")
+            headless = true;
+        else if (argument == "--pipeline-stats")
+            pipelineStatistics = true;
+        else if (argument == "--trace" && i + 1 < argc)
+            tracePath = argv[++i];
+        else if (argument == "--memory-report" && i + 1 < argc)
+            memoryReportPath = argv[++i];
+    }
+
     try {
-        App app = App::Create();
+        App app = App::Create(headless, pipelineStatistics, tracePath, memoryReportPath);
         
         app.Run();
     }
@@ -29,4 +29,24 @@ std::vector<char> readFileBinary(const std::string &filePath)
     file.close();
 
     return buffer;
-}
\ No newline at end of file
+}
+
+void hashCombine(size_t &seed, size_t value)
+{
+    seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+}
+
+uint64_t hashBytes(const void *data, size_t size)
+{
+    // FNV-1a
+    const unsigned char *bytes = static_cast<const unsigned char*>(data);
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}